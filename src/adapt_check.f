@@ -4,7 +4,7 @@ c     *                      subroutine adapt_check                  *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 1/11/2018 RHD              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     executes all logic to drive the adaptive solution        *
 c     *     process for the static analysis of a load step           *
@@ -15,6 +15,7 @@ c
       subroutine adapt_check( scaling_adapt, process_type, step,
      &                        iout )
       use adaptive_steps
+      use main_data, only : convergence_history, adapt_target_iters
       implicit none
 c
 c              parameters
@@ -24,7 +25,7 @@ c
 c
 c              locals
 c
-      integer :: num_subs, i, j
+      integer :: num_subs, i, j, last_subs, avg_iters
       logical :: local_debug
       double precision ::
      & start_scale, end_scale, incr_scale, start, zero, one
@@ -55,50 +56,7 @@ c
            return
       end if
 c
-      start_scale  = adaptive_stack(1,adapt_level)
-      end_scale    = adaptive_stack(2,adapt_level)
-      incr_scale   = (end_scale - start_scale) / dble(num_subs)
-c
-      if( adapt_level+num_subs .ge. adapt_cols ) then
-        write(iout,9010) adapt_level+num_subs
-        call die_abort
-      end if
-      do i = adapt_level+1, adapt_level+num_subs, 1
-        adaptive_stack(3,i) = incr_scale
-      end do
-c
-      start = start_scale
-      do i = adapt_level+num_subs, adapt_level+1, -1
-        adaptive_stack(1,i) = start
-        adaptive_stack(2,i) = start + incr_scale
-        start               = start + incr_scale
-      end do
-c
-      if( local_debug ) write (iout,9500)
-     &    adapt_level+num_subs, adaptive_stack(4,adapt_level+num_subs),
-     &    adapt_level, adaptive_stack(4,adapt_level),
-     &    adaptive_stack(4,adapt_level+num_subs)
-c
-c        the adaptive_stack contains a scaling factor for extrapolating
-c        solution parameters from one subincremented step to the next.
-c        this section of code calculates the beginning and ending scaling
-c        factors for this adaptive cut and then fill in the remaining
-c        values inbetween with 1.0
-c
-      adaptive_stack(4,adapt_level+num_subs) =
-     &          adaptive_stack(4,adapt_level) / num_subs
-      adaptive_stack(4,adapt_level) = adaptive_stack(4,adapt_level) /
-     &          adaptive_stack(4,adapt_level+num_subs)
-      adaptive_stack(4,adapt_level+1:adapt_level+num_subs-1) = one
-c
-c
-c
-      adapt_level       = adapt_level + num_subs
-      scaling_adapt     = adaptive_stack(4,adapt_level)
-      adapt_disp_fact   = adaptive_stack(3,adapt_level)
-      adapt_temper_fact = adaptive_stack(3,adapt_level)
-      adapt_load_fact   = adaptive_stack(2,adapt_level)
-      adapt_result      = 2
+      call adapt_check_subdivide
       write(iout,*) ' '
       write(iout,9300) step, start_scale, end_scale,
      &                 incr_scale, adaptive_stack(1,adapt_level),
@@ -181,6 +139,47 @@ c
       adapt_divisions     = 4
       adapt_min_fact      = one / dble(adapt_divisions**2)
       scaling_adapt       = one
+c
+c                         process type - 4
+c                         ----------------
+c
+c            predictive step control. called after type 3 at the
+c            start of a step when the user set a target number of
+c            newton iterations. the prior step's iterations per
+c            increment (convergence_history) set how many equal
+c            increments to start this step with: twice as many as
+c            the prior step when it ran well over the target, half
+c            as many when well under it, else the same. this cuts
+c            ahead of failures instead of after a failed attempt
+c            and lets the step size grow back in benign regions.
+c            at most adapt_divisions so the usual reactive cut is
+c            still available below. the increments stay within
+c            the user-defined step.
+c
+      case( 4 )
+      adapt_result = 1
+      if( adapt_target_iters .le. 0 ) return
+      if( .not. convergence_history(5)%step_converged ) return
+      last_subs = max( 1, convergence_history(5)%adapt_substeps )
+      avg_iters = convergence_history(5)%iterations_for_convergence /
+     &            last_subs
+      if( avg_iters .le. 0 ) return
+      num_subs = last_subs
+      if( 2*avg_iters .gt. 3*adapt_target_iters ) then
+        num_subs = 2 * last_subs
+      elseif( 2*avg_iters .lt. adapt_target_iters ) then
+        num_subs = last_subs / 2
+      end if
+      num_subs = max( 1, min( num_subs, adapt_divisions ) )
+      if( num_subs .eq. 1 ) return
+c
+      call adapt_check_subdivide
+      write(iout,*) ' '
+      write(iout,9310) step, avg_iters, adapt_target_iters, num_subs,
+     &                 adaptive_stack(1,adapt_level),
+     &                 adaptive_stack(2,adapt_level)
+      write(iout,*) ' '
+      call adapt_check_a
 c
       case default
         write(iout,9000)
@@ -191,23 +190,21 @@ c
 c
  9000 format( 1x,'>>>>> FATAL Error: adapt_check. bad process_type',
      &   /,   1x,'                   job aborted.',/)
- 9010 format( 1x,'>>>>> FATAL Error: adapt_check. table overflow: ',i5,
-     &   /,   1x,'                   job aborted.',/)
  9200 format(/,4x,'adaptive solution for load step: ',i7,
      & /,    7x,'now advancing step solution from: ',f7.4,' to: ',f7.4)
  9300 format(/,6x,'adaptive solution driver for step: ',i7,
      & /, 9x,'subdividing current increment from: ',f7.4,' to: ',f7.4,
      & /, 9x,'into smaller increments of:         ',f7.4,
      & /, 9x,'now advancing step solution from:   ',f7.4,' to: ',f7.4)
+ 9310 format(/,6x,'adaptive solution driver for step: ',i7,
+     & /, 9x,'prior step averaged ',i3,' iterations (target ',i3,')',
+     & /, 9x,'starting step with increments of 1/',i2,
+     & /, 9x,'now advancing step solution from:   ',f7.4,' to: ',f7.4)
  9420 format(/,6x,'adaptive solution for load step: ',i7,
      & /, 9x,'failed in advancing increment from: ',f7.4,' to: ',f7.4,
      & /, 9x,'subdivision limit has been reached.',
      & /, 9x,'the analysis will be terminated; restart from last ',
      & /, 9x,'converged database file.')
- 9500 format ( ' Divide adaptive scaling factor (', i3, ') = ',
-     &           e16.6, ' by ', i3  /
-     & ' Divide adaptive scaling factor (', i3, ') = ',
-     &           e16.6, ' by ', e16.6  )
  9510 format ( 3x, ' Multiply the adaptive scale factor in row ',
      &               i3 / ' by to obtain the following ',
      &             'adaptive_stack = ',e16.6 )
@@ -229,5 +226,67 @@ c
  9100 format(1x,i4,4f12.4)
 c
       end subroutine adapt_check_a
+c
+      subroutine adapt_check_subdivide
+c
+c            replace the increment at the top of the stack by
+c            num_subs equal increments. the first one becomes the
+c            new top.
+c
+      start_scale  = adaptive_stack(1,adapt_level)
+      end_scale    = adaptive_stack(2,adapt_level)
+      incr_scale   = (end_scale - start_scale) / dble(num_subs)
+c
+      if( adapt_level+num_subs .ge. adapt_cols ) then
+        write(iout,9010) adapt_level+num_subs
+        call die_abort
+      end if
+      do i = adapt_level+1, adapt_level+num_subs, 1
+        adaptive_stack(3,i) = incr_scale
+      end do
+c
+      start = start_scale
+      do i = adapt_level+num_subs, adapt_level+1, -1
+        adaptive_stack(1,i) = start
+        adaptive_stack(2,i) = start + incr_scale
+        start               = start + incr_scale
+      end do
+c
+      if( local_debug ) write (iout,9500)
+     &    adapt_level+num_subs, adaptive_stack(4,adapt_level+num_subs),
+     &    adapt_level, adaptive_stack(4,adapt_level),
+     &    adaptive_stack(4,adapt_level+num_subs)
+c
+c        the adaptive_stack contains a scaling factor for extrapolating
+c        solution parameters from one subincremented step to the next.
+c        this section of code calculates the beginning and ending scaling
+c        factors for this adaptive cut and then fill in the remaining
+c        values inbetween with 1.0
+c
+      adaptive_stack(4,adapt_level+num_subs) =
+     &          adaptive_stack(4,adapt_level) / num_subs
+      adaptive_stack(4,adapt_level) = adaptive_stack(4,adapt_level) /
+     &          adaptive_stack(4,adapt_level+num_subs)
+      adaptive_stack(4,adapt_level+1:adapt_level+num_subs-1) = one
+c
+c
+c
+      adapt_level       = adapt_level + num_subs
+      scaling_adapt     = adaptive_stack(4,adapt_level)
+      adapt_disp_fact   = adaptive_stack(3,adapt_level)
+      adapt_temper_fact = adaptive_stack(3,adapt_level)
+      adapt_load_fact   = adaptive_stack(2,adapt_level)
+      adapt_result      = 2
+c
+      return
+c
+ 9010 format( 1x,'>>>>> FATAL Error: adapt_check. table overflow: ',i5,
+     &   /,   1x,'                   job aborted.',/)
+ 9500 format ( ' Divide adaptive scaling factor (', i3, ') = ',
+     &           e16.6, ' by ', i3  /
+     & ' Divide adaptive scaling factor (', i3, ') = ',
+     &           e16.6, ' by ', e16.6  )
+c
+      end subroutine adapt_check_subdivide
       end subroutine adapt_check
 
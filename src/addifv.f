@@ -15,7 +15,7 @@ c
 c                                                                               
       subroutine addifv( span, bedst, totdof, ifv, iprops,                      
      &                   felem, sum_ifv, num_term_ifv,                          
-     &                   eleifv, dam_ifv, dam_state, out )                      
+     &                   eleifv, dam_ifv, dam_state, out, scatter )
       use damage_data, only : dam_ptr, growth_by_kill                           
       implicit none                                                    
       include 'param_def'                                                       
@@ -25,6 +25,7 @@ c
      &           dam_state(*)                                                   
       double precision :: ifv(*), sum_ifv, eleifv(span,*),
      &                    dam_ifv(mxedof,*)                     
+      logical :: scatter
       logical, parameter :: debug = .false.                                                          
 c                                                                               
 c             locals                                                            
@@ -33,14 +34,20 @@ c
 c                                                                                 
       if( debug ) write (out,*) '>>>>  inside addifv'                           
 c                                                                               
-      do j = 1, totdof                                                          
-         do i = 1, span                                                         
-c$OMP ATOMIC UPDATE                                                             
-            ifv(bedst(j,i)) = ifv(bedst(j,i)) + eleifv(i,j)                     
-         end do                                                                 
-      end do 
+c             scatter = .false. when the terms are instead gathered
+c             node-by-node later (see addifv_gather)
+c
+      if( scatter ) then
+       do j = 1, totdof
+         do i = 1, span
+c$OMP ATOMIC UPDATE
+            ifv(bedst(j,i)) = ifv(bedst(j,i)) + eleifv(i,j)
+         end do
+       end do
+      end if
 c           
-c             thread private value passed for sum_ifv, num_term_ifv
+c             block value passed for sum_ifv, thread private
+c             value for num_term_ifv
 c                                                 
       do j = 1, totdof                                                          
 !DIR$ IVDEP                                                                     
@@ -90,9 +97,154 @@ c
       if( debug ) write (out,*) '<<<<  leaving  addifv'                         
       return                                                                    
 c                                                                               
- 9000 format(1x,'dof:',i2,' element ifv:',e14.6,' total ifv:',e14.6)            
  9100 format(1x,'FATAL ERROR: in adifv. contact WARP3D developers')             
  9200 format(/,2x,'... addifv for block with first element: ',i7)               
  9300 format(5x,8e14.6)                                                         
 c                                                                               
       end                                                                       
+c     ****************************************************************
+c     *                                                              *
+c     *                   subroutine addifv_gather                   *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     assemble the element internal force vectors into the     *
+c     *     global ifv by a gather over structure nodes. each node   *
+c     *     sums the terms of its connected elements in a fixed      *
+c     *     order. no atomics and the result does not depend on the  *
+c     *     number of threads                                        *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine addifv_gather
+      use global_data ! old common.main
+      use elem_block_data, only : einfvec_blocks, ifv_gather_ptr,
+     &                            ifv_gather_elem, ifv_gather_lnode
+      use elem_extinct_data, only : dam_blk_killed
+      use main_data, only : elems_to_blocks
+      use damage_data, only : growth_by_kill
+      implicit none
+c
+      integer :: node, p, elem, blk, rel, k, nnode, dof
+      double precision :: f1, f2, f3
+      double precision, parameter :: zero = 0.0d0
+c
+      if( .not. allocated( ifv_gather_ptr ) )
+     &    call addifv_gather_setup
+c
+c$OMP PARALLEL DO PRIVATE( node, p, elem, blk, rel, k, nnode, dof,
+c$OMP&                     f1, f2, f3 )
+      do node = 1, nonode
+        f1 = zero
+        f2 = zero
+        f3 = zero
+        do p = ifv_gather_ptr(node), ifv_gather_ptr(node+1) - 1
+          elem = ifv_gather_elem(p)
+          blk  = elems_to_blocks(elem,1)
+          if( growth_by_kill ) then
+            if( dam_blk_killed(blk) ) cycle
+          end if
+          rel   = elems_to_blocks(elem,2)
+          k     = ifv_gather_lnode(p)
+          nnode = iprops(2,elem)
+          f1 = f1 + einfvec_blocks(blk)%ptr(rel,k)
+          f2 = f2 + einfvec_blocks(blk)%ptr(rel,nnode+k)
+          f3 = f3 + einfvec_blocks(blk)%ptr(rel,2*nnode+k)
+        end do
+        dof = dstmap(node)
+        ifv(dof)   = ifv(dof)   + f1
+        ifv(dof+1) = ifv(dof+1) + f2
+        ifv(dof+2) = ifv(dof+2) + f3
+      end do
+c$OMP END PARALLEL DO
+c
+      return
+      end
+c     ****************************************************************
+c     *                                                              *
+c     *                subroutine addifv_gather_setup                *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     build the node -> (element, local node) table used by    *
+c     *     addifv_gather. only blocks owned by this rank. an        *
+c     *     element with a repeated node appears once for each       *
+c     *     occurrence                                               *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine addifv_gather_setup
+      use global_data ! old common.main
+      use elem_block_data, only : ifv_gather_ptr, ifv_gather_elem,
+     &                            ifv_gather_lnode
+      use main_data, only : incid, incmap
+      implicit none
+c
+      integer :: blk, felem, span, nnode, elem, j, node, nterms, iok
+      integer, allocatable :: next(:)
+c
+      allocate( ifv_gather_ptr(nonode+1), next(nonode), stat=iok )
+      if( iok .ne. 0 ) then
+        write(out,9100) iok
+        call die_abort
+      end if
+c
+c             count terms on each node, then make pointers
+c
+      next(1:nonode) = 0
+      do blk = 1, nelblk
+        if( elblks(2,blk) .ne. myid ) cycle
+        felem = elblks(1,blk)
+        span  = elblks(0,blk)
+        nnode = iprops(2,felem)
+        do elem = felem, felem + span - 1
+          do j = 1, nnode
+            node = incid(incmap(elem)+j-1)
+            next(node) = next(node) + 1
+          end do
+        end do
+      end do
+c
+      ifv_gather_ptr(1) = 1
+      do node = 1, nonode
+        ifv_gather_ptr(node+1) = ifv_gather_ptr(node) + next(node)
+      end do
+      nterms = ifv_gather_ptr(nonode+1) - 1
+c
+      allocate( ifv_gather_elem(nterms), ifv_gather_lnode(nterms),
+     &          stat=iok )
+      if( iok .ne. 0 ) then
+        write(out,9100) iok
+        call die_abort
+      end if
+c
+c             fill in block, element, local node order. this
+c             fixes the summation order at each node
+c
+      next(1:nonode) = ifv_gather_ptr(1:nonode)
+      do blk = 1, nelblk
+        if( elblks(2,blk) .ne. myid ) cycle
+        felem = elblks(1,blk)
+        span  = elblks(0,blk)
+        nnode = iprops(2,felem)
+        do elem = felem, felem + span - 1
+          do j = 1, nnode
+            node = incid(incmap(elem)+j-1)
+            ifv_gather_elem(next(node))  = elem
+            ifv_gather_lnode(next(node)) = j
+            next(node) = next(node) + 1
+          end do
+        end do
+      end do
+c
+      deallocate( next )
+      return
+c
+ 9100 format('>> FATAL ERROR: addifv_gather_setup, memory allocate',
+     &  ' failure. status: ',i5,/,'                Job terminated...')
+c
+      end
@@ -785,7 +785,7 @@ c
      &                        noelem, row_start_index, edest,                   
      &                        previous_snode )         
       use global_data, only : out                         
-      use elem_block_data, only : estiff_blocks                                 
+      use elem_block_data, only : estiff_blocks, estiff_blocks_sp
       use main_data,       only : elems_to_blocks, repeat_incid,                
      &                            inverse_incidences                            
       implicit none                                                             
@@ -807,8 +807,9 @@ c
      &           rel_col, start_loc                                             
       double precision, parameter :: zero = 0.d0, k_tol = 1.d-30                                                  
       double precision, dimension(:,:), pointer :: emat                         
+      real, dimension(:,:), pointer :: semat
 c                                                                               
-      logical :: repeated                                                       
+      logical :: repeated, single
 c                                                                               
 c                 get the structure node number corresponding to this           
 c                 equation.                                                     
@@ -839,11 +840,16 @@ c
           totdof  = iprops(2,ele_on_snode) * iprops(4,ele_on_snode)             
           blk     = elems_to_blocks(ele_on_snode,1)                             
           rel_col = elems_to_blocks(ele_on_snode,2)    
-          if( .not. associated( estiff_blocks(blk)%ptr ) ) then
-            write(out,9100) srow, ele_on_snode
-            call die_abort
+          single  = .not. associated( estiff_blocks(blk)%ptr )
+          if( single ) then
+            if( .not. associated( estiff_blocks_sp(blk)%ptr ) ) then
+              write(out,9100) srow, ele_on_snode
+              call die_abort
+            end if
+            semat => estiff_blocks_sp(blk)%ptr
+          else
+            emat  => estiff_blocks(blk)%ptr
           end if                        
-          emat    => estiff_blocks(blk)%ptr                                     
           if( totdof .eq. 24 ) then                                             
              call assem_a_row_24                                                
              cycle                                                              
@@ -914,18 +920,33 @@ c
 c                                                                               
       local_scol(1:24) =  dof_eqn_map(edest(1:24,j))                            
 c                                                                               
-      do erow = 1, 24                                                           
-       if( local_scol(erow) .ne. srow ) cycle                                   
+      if( single ) then
+        do erow = 1, 24
+         if( local_scol(erow) .ne. srow ) cycle
 !DIR$ IVDEP                                                                     
-       do ecol = 1, 24                                                          
-         scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))                   
-         if ( scol .lt. srow ) cycle ! lower triange                            
-         kk = dcp(max0(ecol,erow))-iabs(ecol - erow)                            
-         ekterm = estiff_blocks(blk)%ptr(kk,rel_col)    
-         coeff_row(scol) = coeff_row(scol) + ekterm                             
-       end do                                                                   
-       if( .not. repeated ) return                                              
-      end do                                                                    
+         do ecol = 1, 24
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if ( scol .lt. srow ) cycle ! lower triange
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = semat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      else
+        do erow = 1, 24
+         if( local_scol(erow) .ne. srow ) cycle
+!DIR$ IVDEP
+         do ecol = 1, 24
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if ( scol .lt. srow ) cycle ! lower triange
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = emat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      end if
       return                                                                    
       end subroutine assem_a_row_24                                             
                                                                                 
@@ -937,18 +958,33 @@ c
 c                                                                               
       local_scol(1:30) =  dof_eqn_map(edest(1:30,j))                            
 c                                                                               
-      do erow = 1, 30                                                           
-       if( local_scol(erow) .ne. srow ) cycle                                   
+      if( single ) then
+        do erow = 1, 30
+         if( local_scol(erow) .ne. srow ) cycle
 !DIR$ IVDEP                                                                     
-       do ecol = 1, 30                                                          
-         scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))                   
-         if( scol .lt. srow ) cycle                                             
-         kk = dcp(max0(ecol,erow))-iabs(ecol - erow)                            
-         ekterm = emat(kk,rel_col)                                              
-         coeff_row(scol) = coeff_row(scol) + ekterm                             
-       end do                                                                   
-       if( .not. repeated ) return                                              
-      end do                                                                    
+         do ecol = 1, 30
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if( scol .lt. srow ) cycle
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = semat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      else
+        do erow = 1, 30
+         if( local_scol(erow) .ne. srow ) cycle
+!DIR$ IVDEP
+         do ecol = 1, 30
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if( scol .lt. srow ) cycle
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = emat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      end if
       return                                                                    
       end subroutine assem_a_row_30                                             
                                                                                 
@@ -960,18 +996,33 @@ c
 c                                                                               
       local_scol(1:36) =  dof_eqn_map(edest(1:36,j))                            
 c                                                                               
-      do erow = 1, 36                                                           
-       if( local_scol(erow) .ne. srow ) cycle                                   
+      if( single ) then
+        do erow = 1, 36
+         if( local_scol(erow) .ne. srow ) cycle
 !DIR$ IVDEP                                                                     
-       do ecol = 1, 36                                                          
-         scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))                   
-         if( scol .lt. srow ) cycle                                             
-         kk = dcp(max0(ecol,erow))-iabs(ecol - erow)                            
-         ekterm = emat(kk,rel_col)                                              
-         coeff_row(scol) = coeff_row(scol) + ekterm                             
-       end do                                                                   
-       if( .not. repeated ) return                                              
-      end do                                                                    
+         do ecol = 1, 36
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if( scol .lt. srow ) cycle
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = semat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      else
+        do erow = 1, 36
+         if( local_scol(erow) .ne. srow ) cycle
+!DIR$ IVDEP
+         do ecol = 1, 36
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if( scol .lt. srow ) cycle
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = emat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      end if
       return                                                                    
       end subroutine assem_a_row_36                                             
                                                                                 
@@ -983,18 +1034,33 @@ c
 c
       local_scol(1:60) =  dof_eqn_map(edest(1:60,j))                     
 c                                                                                
-      do erow = 1, 60                                                           
-       if( local_scol(erow) .ne. srow ) cycle                                   
+      if( single ) then
+        do erow = 1, 60
+         if( local_scol(erow) .ne. srow ) cycle
 !DIR$ IVDEP                                                                     
-       do ecol = 1, 60                                                          
-         scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))                   
-         if( scol .lt. srow ) cycle                                             
-         kk = dcp(max0(ecol,erow))-iabs(ecol - erow)                            
-         ekterm = emat(kk,rel_col)                                              
-         coeff_row(scol) = coeff_row(scol) + ekterm                             
-       end do                                                                   
-       if( .not. repeated ) return                                              
-      end do                                                                    
+         do ecol = 1, 60
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if( scol .lt. srow ) cycle
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = semat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      else
+        do erow = 1, 60
+         if( local_scol(erow) .ne. srow ) cycle
+!DIR$ IVDEP
+         do ecol = 1, 60
+           scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+           if( scol .lt. srow ) cycle
+           kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+           ekterm = emat(kk,rel_col)
+           coeff_row(scol) = coeff_row(scol) + ekterm
+         end do
+         if( .not. repeated ) return
+        end do
+      end if
       return                                                                    
       end subroutine assem_a_row_60                                             
                                                                                 
@@ -1006,18 +1072,33 @@ c
 c                                                                               
       local_scol(1:totdof) =  dof_eqn_map(edest(1:totdof,j))                    
 c                                                                               
-      do erow = 1, totdof                                                       
-       if( local_scol(erow) .ne. srow ) cycle                                   
+      if( single ) then
+        do erow = 1, totdof
+         if( local_scol(erow) .ne. srow ) cycle
 !DIR$ IVDEP                                                                     
-        do ecol = 1, totdof                                                     
-          scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))                  
-          if( scol .lt. srow ) cycle                                            
-          kk = dcp(max0(ecol,erow))-iabs(ecol - erow)                           
-          ekterm = emat(kk,rel_col)                                             
-          coeff_row(scol) = coeff_row(scol) + ekterm                            
-        end do                                                                  
-        if( .not. repeated ) return                                             
-      end do                                                                    
+          do ecol = 1, totdof
+            scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+            if( scol .lt. srow ) cycle
+            kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+            ekterm = semat(kk,rel_col)
+            coeff_row(scol) = coeff_row(scol) + ekterm
+          end do
+          if( .not. repeated ) return
+        end do
+      else
+        do erow = 1, totdof
+         if( local_scol(erow) .ne. srow ) cycle
+!DIR$ IVDEP
+          do ecol = 1, totdof
+            scol = local_scol(ecol) ! dof_eqn_map(edest(ecol,j))
+            if( scol .lt. srow ) cycle
+            kk = dcp(max0(ecol,erow))-iabs(ecol - erow)
+            ekterm = emat(kk,rel_col)
+            coeff_row(scol) = coeff_row(scol) + ekterm
+          end do
+          if( .not. repeated ) return
+        end do
+      end if
       return                                                                    
       end subroutine assem_a_row_gen                                            
                                                                                 
@@ -1123,7 +1204,7 @@ c
       subroutine assem_a_row_asym( srow, eqn_node_map, dof_eqn_map,             
      &                             iprops, num_k_indexes, k_indexes,            
      &                             edest, k_coeffs, previous_snode)             
-      use elem_block_data, only : estiff_blocks                                 
+      use elem_block_data, only : estiff_blocks, estiff_blocks_sp
       use main_data, only: elems_to_blocks, repeat_incid,                       
      &                     inverse_incidences                                   
       implicit none                                                             
@@ -1142,6 +1223,8 @@ c
      &           rel_col, erow, ecol, scol, k, ekrow, bs_start,                 
      &           bs_finish, bs_range                                            
       double precision, dimension(:,:), pointer :: emat                         
+      real, dimension(:,:), pointer :: semat
+      logical :: single
 c                                                                               
 c                 - get structure node number for this equation                 
 c                 - number of element connected to snode                        
@@ -1183,37 +1266,69 @@ c
         totdof = iprops(2,ele_on_snode) * iprops(4,ele_on_snode)                
         blk = elems_to_blocks(ele_on_snode,1)                                   
         rel_col = elems_to_blocks(ele_on_snode,2)                               
-        emat => estiff_blocks(blk)%ptr                                          
+        single  = .not. associated( estiff_blocks(blk)%ptr )
+        if( single ) then
+          semat => estiff_blocks_sp(blk)%ptr
+        else
+          emat  => estiff_blocks(blk)%ptr
+        end if
 c                                                                               
         if( repeat_incid(ele_on_snode) ) then                                   
          call assem_a_row_asym_repeated                                         
          cycle                                                                  
         end if                                                                  
 c                                                                               
-        do erow = 1, totdof ! which row of Ke for this eqn #                    
-          if( dof_eqn_map(edest(erow,e)) .ne. srow) cycle                       
-          ekrow = ( erow - 1 ) * totdof                                         
-          do ecol = 1, totdof                                                   
-            scol  = dof_eqn_map(edest(ecol,e))                                  
-            ekrow = ekrow + 1                                                   
-            if( scol .eq. 0 ) cycle                                             
-            bs_start  =  1   ! start in-place binary search                     
-            bs_finish = num_k_indexes                                           
-            bs_range  = bs_finish - bs_start                                    
-            k = (bs_start + bs_finish) / 2                                      
-            do while( k_indexes(k) /= scol .and. bs_range >  0)                 
-               if( scol > k_indexes(k) ) then                                   
-                  bs_start = k + 1                                              
-               else                                                             
-                  bs_finish = k - 1                                             
-               end if                                                           
-               bs_range = bs_finish - bs_start                                  
-               k = (bs_start + bs_finish) / 2                                   
-            end do                                                              
-            if( k_indexes(k) /= scol ) call assem_a_row_asym_error              
-            k_coeffs(k) = k_coeffs(k) + emat(ekrow,rel_col)                     
-          end do ! on ecol                                                      
-        end do ! on erow                                                        
+        if( single ) then
+          do erow = 1, totdof ! which row of Ke for this eqn #
+            if( dof_eqn_map(edest(erow,e)) .ne. srow) cycle
+            ekrow = ( erow - 1 ) * totdof
+            do ecol = 1, totdof
+              scol  = dof_eqn_map(edest(ecol,e))
+              ekrow = ekrow + 1
+              if( scol .eq. 0 ) cycle
+              bs_start  =  1   ! start in-place binary search
+              bs_finish = num_k_indexes
+              bs_range  = bs_finish - bs_start
+              k = (bs_start + bs_finish) / 2
+              do while( k_indexes(k) /= scol .and. bs_range >  0)
+                 if( scol > k_indexes(k) ) then
+                    bs_start = k + 1
+                 else
+                    bs_finish = k - 1
+                 end if
+                 bs_range = bs_finish - bs_start
+                 k = (bs_start + bs_finish) / 2
+              end do
+              if( k_indexes(k) /= scol ) call assem_a_row_asym_error
+              k_coeffs(k) = k_coeffs(k) + semat(ekrow,rel_col)
+            end do ! on ecol
+          end do ! on erow
+        else
+          do erow = 1, totdof ! which row of Ke for this eqn #
+            if( dof_eqn_map(edest(erow,e)) .ne. srow) cycle
+            ekrow = ( erow - 1 ) * totdof
+            do ecol = 1, totdof
+              scol  = dof_eqn_map(edest(ecol,e))
+              ekrow = ekrow + 1
+              if( scol .eq. 0 ) cycle
+              bs_start  =  1   ! start in-place binary search
+              bs_finish = num_k_indexes
+              bs_range  = bs_finish - bs_start
+              k = (bs_start + bs_finish) / 2
+              do while( k_indexes(k) /= scol .and. bs_range >  0)
+                 if( scol > k_indexes(k) ) then
+                    bs_start = k + 1
+                 else
+                    bs_finish = k - 1
+                 end if
+                 bs_range = bs_finish - bs_start
+                 k = (bs_start + bs_finish) / 2
+              end do
+              if( k_indexes(k) /= scol ) call assem_a_row_asym_error
+              k_coeffs(k) = k_coeffs(k) + emat(ekrow,rel_col)
+            end do ! on ecol
+          end do ! on erow
+        end if
       end do ! on e over elements connected to snode                            
 c                                                                               
       return                                                                    
@@ -1240,20 +1355,37 @@ c
       subroutine assem_a_row_asym_repeated  ! and small num_k_indexes           
       implicit none                                                             
 c                                                                               
-      do erow = 1, totdof ! which row of Ke for this eqn #                      
-          if( dof_eqn_map(edest(erow,e)) .ne. srow) cycle                       
-          ekrow = ( erow - 1 ) * totdof                                         
-          do ecol = 1, totdof                                                   
-            scol  = dof_eqn_map(edest(ecol,e))                                  
-            ekrow = ekrow + 1                                                   
-            if( scol .eq. 0 ) cycle                                             
-            do k = 1, num_k_indexes ! which ecol if any. may repeat             
-              if( k_indexes(k) .eq. scol ) then                                 
-                k_coeffs(k) = k_coeffs(k) + emat(ekrow,rel_col)                 
-              end if                                                            
-            end do ! on k                                                       
-          end do ! on ecol                                                      
-      end do ! on erow                                                          
+      if( single ) then
+        do erow = 1, totdof ! which row of Ke for this eqn #
+            if( dof_eqn_map(edest(erow,e)) .ne. srow) cycle
+            ekrow = ( erow - 1 ) * totdof
+            do ecol = 1, totdof
+              scol  = dof_eqn_map(edest(ecol,e))
+              ekrow = ekrow + 1
+              if( scol .eq. 0 ) cycle
+              do k = 1, num_k_indexes ! which ecol if any. may repeat
+                if( k_indexes(k) .eq. scol ) then
+                  k_coeffs(k) = k_coeffs(k) + semat(ekrow,rel_col)
+                end if
+              end do ! on k
+            end do ! on ecol
+        end do ! on erow
+      else
+        do erow = 1, totdof ! which row of Ke for this eqn #
+            if( dof_eqn_map(edest(erow,e)) .ne. srow) cycle
+            ekrow = ( erow - 1 ) * totdof
+            do ecol = 1, totdof
+              scol  = dof_eqn_map(edest(ecol,e))
+              ekrow = ekrow + 1
+              if( scol .eq. 0 ) cycle
+              do k = 1, num_k_indexes ! which ecol if any. may repeat
+                if( k_indexes(k) .eq. scol ) then
+                  k_coeffs(k) = k_coeffs(k) + emat(ekrow,rel_col)
+                end if
+              end do ! on k
+            end do ! on ecol
+        end do ! on erow
+      end if
 c                                                                               
       return                                                                    
       end subroutine  assem_a_row_asym_repeated                                 
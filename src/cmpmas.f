@@ -313,3 +313,98 @@ c
 c                                                                               
 c                                                                               
       end subroutine mass_getint                                                
+c     ****************************************************************
+c     *                                                              *
+c     *                   subroutine cmpmas_stable_dt                *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     estimate the critical (stable) time step for explicit    *
+c     *     central difference integration with the lumped mass.     *
+c     *     min over elements of length / dilatational wave speed    *
+c     *                                                              *
+c     ****************************************************************
+c
+c
+      subroutine cmpmas_stable_dt( dt_stable, elem_min )
+      use global_data ! old common.main
+c
+      use elem_block_data, only : cdest_blocks
+      use main_data,       only : cohesive_ele_types, bar_types,
+     &                            link_types
+c
+      implicit none
+c
+c              parameters
+c
+      integer :: elem_min
+      double precision :: dt_stable
+c
+c              locals
+c
+      integer :: blk, felem, elem_type, num_enodes, num_enode_dof,
+     &           totdof, span, i
+      double precision :: ce_block(mxvl,mxecor), lengths(mxvl),
+     &                    e, nu, rho, wave, dt_elem, geo_fact
+      double precision, parameter :: zero = 0.0d0, one = 1.0d0,
+     &                  two = 2.0d0, three = 3.0d0, big = 1.0d30
+      logical :: brick, tet
+c
+c              characteristic_elem_length gives the average of the
+c              cross diagonals (hex) or of 4 edges (tet), halved for
+c              quadratic elements. scale to an edge (hex: 1/sqrt(3))
+c              or height (tet: sqrt(2/3)) measure. blocks of other
+c              element types (wedge, cohesive, bar, link), and
+c              elements with non-positive E or rho (fgm values at
+c              nodes) do not limit the step.
+c
+c              undeformed coordinates. the estimate is computed once
+c              (see mnralg) - the fraction on the user step covers
+c              moderate changes in element size.
+c
+      dt_stable = big
+      elem_min  = 0
+c
+      do blk = 1, nelblk
+         if( myid .ne. elblks(2,blk) ) cycle
+         felem         = elblks(1,blk)
+         elem_type     = iprops(1,felem)
+         num_enodes    = iprops(2,felem)
+         num_enode_dof = iprops(4,felem)
+         totdof        = num_enodes * num_enode_dof
+         span          = elblks(0,blk)
+         if( cohesive_ele_types(elem_type) .or. bar_types(elem_type)
+     &       .or. link_types(elem_type) ) cycle
+         brick = elem_type .ge. 1  .and. elem_type .le. 5
+         tet   = elem_type .eq. 6 .or. elem_type .eq. 13
+         if( .not. ( brick .or. tet ) ) cycle
+         geo_fact = one / sqrt( three )
+         if( tet ) geo_fact = sqrt( two / three )
+c
+         call dupmas( span, num_enodes, cdest_blocks(blk)%ptr(1,1),
+     &                c, totdof, ce_block, mxvl )
+         call characteristic_elem_length( elem_type, span, num_enodes,
+     &                ce_block, lengths, out )
+c
+         do i = 1, span
+           e   = props(7,felem+i-1)
+           nu  = props(8,felem+i-1)
+           rho = props(10,felem+i-1)
+           if( e .le. zero .or. rho .le. zero ) cycle
+           if( nu .ge. 0.4999d0 ) nu = 0.4999d0
+           wave = sqrt( e * (one-nu) /
+     &                  ( (one+nu) * (one-two*nu) * rho ) )
+           dt_elem = geo_fact * lengths(i) / wave
+           if( dt_elem .lt. dt_stable ) then
+             dt_stable = dt_elem
+             elem_min  = felem + i - 1
+           end if
+         end do
+      end do
+c
+      if( elem_min .eq. 0 ) dt_stable = zero
+c
+      return
+      end
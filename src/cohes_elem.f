@@ -232,6 +232,98 @@ c
 c                                                                               
 c     ****************************************************************          
 c     *                                                              *          
+c     *                 subroutine cohes_rot_mat_blk                 *          
+c     *                                                              *          
+c     *                       written by : agent                     *          
+c     *                 last modified : 10/19/2026 agent             *          
+c     *                                                              *          
+c     *     bigR for a block of interface elements. small-           *          
+c     *     displacement blocks always see the undeformed            *          
+c     *     coordinates so their bigR is computed once and then      *          
+c     *     copied from cohes_rot_blocks on every later call.        *          
+c     *     geonl blocks go straight to cohes_rot_mat.               *          
+c     *                                                              *          
+c     ****************************************************************          
+c                                                                               
+      subroutine cohes_rot_mat_blk( blk, geonl, span, felem, nnode,             
+     &                              etype, ce, bigR )                           
+      use global_data, only : nelblk                                            
+      use elem_block_data, only : cohes_rot_blocks, cohes_rot_built             
+      implicit none                                                             
+      include 'param_def'                                                       
+c                                                                               
+c                  parameters                                                   
+c                                                                               
+      integer :: blk, span, felem, nnode, etype                                 
+      logical :: geonl                                                          
+      double precision :: ce(mxvl,mxecor), bigR(mxvl,3,3)                       
+c                                                                               
+c                   local data                                                  
+c                                                                               
+      integer :: i, j, k, l                                                     
+      logical :: built                                                          
+      double precision :: x1, y1, z1                                            
+c                                                                               
+      if( geonl ) then                                                          
+        call cohes_rot_mat( span, felem, nnode, etype, ce, bigR )               
+        return                                                                  
+      end if                                                                    
+c                                                                               
+c               first call for the block computes and saves bigR.               
+c               cohes_rot_mat also shifts ce so element 1, node 1               
+c               is at the origin - repeat that shift on later calls             
+c               so callers see the same coordinates.                            
+c                                                                               
+!$OMP CRITICAL (cohes_rot_build)                                                
+      if( .not. allocated( cohes_rot_blocks ) ) then                            
+        allocate( cohes_rot_blocks(nelblk), cohes_rot_built(nelblk) )           
+        cohes_rot_built = .false.                                               
+      end if                                                                    
+      built = cohes_rot_built(blk)                                              
+!$OMP END CRITICAL (cohes_rot_build)                                            
+c                                                                               
+      if( .not. built ) then                                                    
+        call cohes_rot_mat( span, felem, nnode, etype, ce, bigR )               
+        allocate( cohes_rot_blocks(blk)%vector(9*span) )                        
+        l = 0                                                                   
+        do k = 1, 3                                                             
+         do j = 1, 3                                                            
+           cohes_rot_blocks(blk)%vector(l+1:l+span) = bigR(1:span,j,k)          
+           l = l + span                                                         
+         end do                                                                 
+        end do                                                                  
+!$OMP CRITICAL (cohes_rot_build)                                                
+        cohes_rot_built(blk) = .true.                                           
+!$OMP END CRITICAL (cohes_rot_build)                                            
+        return                                                                  
+      end if                                                                    
+c                                                                               
+      x1 = ce(1,1); y1 = ce(1,nnode+1); z1 = ce(1,2*nnode+1)                    
+      do j = 1, nnode                                                           
+!DIR$ IVDEP                                                                     
+         do i = 1, span                                                         
+           ce(i,j) = ce(i,j) - x1                                               
+           ce(i,nnode+j) = ce(i,nnode+j) - y1                                   
+           ce(i,2*nnode+j) = ce(i,2*nnode+j) - z1                               
+         end do                                                                 
+      end do                                                                    
+c                                                                               
+      l = 0                                                                     
+      do k = 1, 3                                                               
+       do j = 1, 3                                                              
+!DIR$ IVDEP                                                                     
+         do i = 1, span                                                         
+           bigR(i,j,k) = cohes_rot_blocks(blk)%vector(l+i)                      
+         end do                                                                 
+         l = l + span                                                           
+       end do                                                                   
+      end do                                                                    
+c                                                                               
+      return                                                                    
+      end                                                                       
+c                                                                               
+c     ****************************************************************          
+c     *                                                              *          
 c     *             subroutine rotate_cohes_var                      *          
 c     *                                                              *          
 c     *                    written by : aroy                         *          
@@ -4,7 +4,7 @@ c     *                                                              *
 c     *  assemble & solve linear equations for a Newton iteration    *
 c     *                                                              *
 c     *                       written by  : rhd                      *
-c     *                   last modified : 11/19/2019 rhd             *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     ****************************************************************
 c
@@ -14,7 +14,8 @@ c
 c
       use elem_block_data, only : edest_blocks
       use main_data, only : repeat_incid, modified_mpcs,
-     &                      asymmetric_assembly, force_solver_rebuild
+     &                      asymmetric_assembly, force_solver_rebuild,
+     &                      dload, arc_solve_load, arc_du_load
       use stiffness_data, only : ncoeff, big_ncoeff, k_coeffs,
      &                           k_indexes,
      &                           ncoeff_from_assembled_profile
@@ -50,7 +51,8 @@ c
 c
       real, external :: wcputime
       double precision, parameter :: zero = 0.0d00
-      double precision, allocatable :: p_vec(:), k_diag(:), u_vec(:)
+      double precision, allocatable :: p_vec(:), k_diag(:), u_vec(:),
+     &                                 u_vec_load(:)
 c
       data old_neqns, old_ncoeff, cpu_stats, save_solver
      &     / 0, 0, .true., .false. /
@@ -193,6 +195,24 @@ c
      &                          solver_out_of_core, solver_memory,
      &                          solver_scr_dir, solver_mkl_iterative )
         if( local_debug ) write(*,*) '... drive_assem_solve @ 5b'
+c
+c              arc-length: 2nd rhs = step load increment with the
+c              factors just computed (mnralg allows arc-length only
+c              with direct, symmetric pardiso and no mpcs).
+c
+        if( arc_solve_load ) then
+          allocate( u_vec_load(neqns) )
+          p_vec(1:neqns) = zero
+          do i = 1, nodof
+            eqn_num = dof_eqn_map(i)
+            if( eqn_num .ne. 0 ) p_vec(eqn_num) = dload(i)
+          end do
+          call pardiso_symmetric( neqns, ncoeff, k_diag, p_vec,
+     &                          u_vec_load, k_coeffs, k_ptrs, k_indexes,
+     &                          cpu_stats, 4, out,
+     &                          solver_out_of_core, solver_memory,
+     &                          solver_scr_dir, solver_mkl_iterative )
+        end if
 
       case( 8 ) ! asymmetric pardiso
 c
@@ -298,6 +318,17 @@ c
       if( local_debug2 ) write(out,9900) (i, u_vec(i), i=1, neqns)
 c
       deallocate( u_vec ) ! scratch vec used by solvers
+c
+      if( allocated( u_vec_load ) ) then
+        do i = 1, nodof
+          if( dof_eqn_map(i) .eq. 0 ) then
+             arc_du_load(i) = zero
+          else
+             arc_du_load(i) = u_vec_load(dof_eqn_map(i))
+          end if
+        end do
+        deallocate( u_vec_load )
+      end if
 c
 c          7.  re-define number of non-zero coefficients in the
 c              equations as solved.
@@ -1403,7 +1434,9 @@ c
         totdof        = nnode * num_enode_dof
         write(fileno) nnode, totdof, span
         write(fileno)  edest_blocks(blk)%ptr
+        call estiff_blk_expand( blk, .true. ) ! file is always double
         write(fileno)  estiff_blocks(blk)%ptr
+        call estiff_blk_compact( blk )
         write(fileno) check_data_key
       end do
       return
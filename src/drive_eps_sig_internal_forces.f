@@ -3,7 +3,7 @@ c     *                drive_eps_sig_internal_forces                 *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified : 6/13/2018 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *      recovers all the strains, stresses                      *
 c     *      and internal forces (integral B-transpose * sigma)      *
@@ -24,7 +24,8 @@ c
       use elem_block_data,   only : einfvec_blocks, edest_blocks
       use elem_extinct_data, only : dam_blk_killed, dam_ifv, dam_state
       use damage_data, only : growth_by_kill
-      use main_data, only: umat_serial
+      use main_data, only: umat_serial, deterministic_ifv,
+     &                     umat_batch_scratch, umat_per_point
 c
       implicit none
 c
@@ -34,24 +35,26 @@ c
 c             locals
 c
       integer :: blk, felem, mat_type, now_thread, num_enodes,
-     &           num_enode_dof, span, j, kkk, totdof, ksize
+     &           num_enode_dof, span, j, kkk, totdof, ksize,
+     &           batch_flag, scratch_words, nwords
       integer :: num_term_ifv_threads(max_threads),
      &           idummy1(1), idummy2(1)
       integer, external :: omp_get_thread_num
 c
       double precision, allocatable :: block_energies(:),
      &                                 block_plastic_work(:),
+     &                                 block_sum_ifv(:),
      &                                 block_stress_norm2s(:),
      &                                 block_strain_norm2s(:)
       double precision :: start_time, sum_stress_norm2s,
      &                    sum_strain_norm2s,
-     &                    end_time, sum_ifv_threads(max_threads)
+     &                    end_time
       double precision, parameter :: zero = 0.0d0, one = 1.0d0
       double precision, external :: omp_get_wtime
       logical, allocatable, dimension(:)  :: step_cut_flags,
      &                                       blks_reqd_serial
 c
-      logical :: umat_matl, run_serial_loop
+      logical :: umat_matl, run_serial_loop, scatter
       logical, parameter :: local_debug = .false.,
      &                      local_debug_sums = .false.
 c
@@ -109,6 +112,7 @@ c
       allocate( block_stress_norm2s(ksize),
      &          block_strain_norm2s(ksize) ) !  for checking MPI
 c
+      scratch_words = 0
       do blk = 1, nelblk
         block_energies(blk)     = zero
         block_plastic_work(blk) = zero
@@ -118,8 +122,28 @@ c
         mat_type                = iprops(25,felem)
         umat_matl               = mat_type .eq. 8
         if( umat_matl .and. umat_serial ) blks_reqd_serial(blk) = .true.
+        if( umat_matl .and. .not. umat_per_point ) then
+          call material_model_info( felem, 0, 5, batch_flag )
+          if( batch_flag .eq. 1 ) then
+            call material_model_info( felem, 0, 6, nwords )
+            scratch_words = max( scratch_words, nwords, 1 )
+          end if
+        end if
       end do
 c
+c             span-batched umats get a column of scratch per thread.
+c             sized here, outside the threaded loop, so the umat
+c             never allocates.
+c
+      if( scratch_words .gt. 0 ) then
+        if( allocated( umat_batch_scratch ) ) then
+          if( size(umat_batch_scratch,1) .lt. scratch_words )
+     &        deallocate( umat_batch_scratch )
+        end if
+        if( .not. allocated( umat_batch_scratch ) )
+     &    allocate( umat_batch_scratch(scratch_words,max_threads) )
+      end if
+c
 c             allocate blocks of element internal force vectors.
 c             we compute the blocks of vectors in parallel then
 c             scatter in serial to eliminate conflicts.
@@ -274,8 +298,16 @@ c             we use local vectors to store sums, counts for each thread
 c             to elminate atomic update on those variable (may still be
 c             faster to use atomic).
 c
-      sum_ifv_threads(1:num_threads) = zero
+c             deterministic_ifv: the block loop only stores killable
+c             element terms and sums. ifv is then built by a gather
+c             over nodes (addifv_gather). sum_ifv is summed by block
+c             in block order. the residual is then independent of the
+c             number of threads.
+c
       num_term_ifv_threads(1:num_threads) = 0
+      scatter = .not. deterministic_ifv
+      allocate( block_sum_ifv(nelblk) )
+      block_sum_ifv = zero
 c
       call omp_set_dynamic( .false. )
       if( local_debug ) start_time = omp_get_wtime()
@@ -298,36 +330,41 @@ c
          if( allocated( dam_ifv ) ) then
            call addifv( span, edest_blocks(blk)%ptr(1,1), totdof,
      &                ifv(1),
-     &                iprops, felem, sum_ifv_threads(now_thread),
+     &                iprops, felem, block_sum_ifv(blk),
      &                num_term_ifv_threads(now_thread),
      &                einfvec_blocks(blk)%ptr(1,1), dam_ifv,
-     &                dam_state, out )
+     &                dam_state, out, scatter )
          else
            call addifv( span, edest_blocks(blk)%ptr(1,1), totdof,
      &                ifv(1),
-     &                iprops, felem, sum_ifv_threads(now_thread),
+     &                iprops, felem, block_sum_ifv(blk),
      &                num_term_ifv_threads(now_thread),
      &                einfvec_blocks(blk)%ptr(1,1), idummy1,
-     &                idummy2, out )
+     &                idummy2, out, scatter )
          end if
 c
       end do
 c
 c$OMP END PARALLEL DO
+c
+      if( deterministic_ifv ) call addifv_gather
 c
       if( local_debug ) then
          end_time = omp_get_wtime()
-         write(out,*) '>> atomic scatter ifv: ', end_time - start_time
+         write(out,*) '>> assemble ifv: ', end_time - start_time
       end if
 c
 c             reduction of scalars sum_ifv and
-c             num_term_ifv for all threads used to process blocks on
-c             this rank.
+c             num_term_ifv for all blocks/threads used to process
+c             blocks on this rank.
 c
+      do blk = 1, nelblk
+        sum_ifv = sum_ifv + block_sum_ifv(blk)
+      end do
       do j = 1, num_threads
-        sum_ifv      = sum_ifv + sum_ifv_threads(j)
         num_term_ifv = num_term_ifv + num_term_ifv_threads(j)
       end do
+      deallocate( block_sum_ifv )
 
       if( local_debug_sums ) then
          write (out,9000) myid, num_term_ifv, norm2( ifv ),
@@ -396,7 +433,7 @@ c     *                      subroutine do_nleps_block               *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 6/13/2018 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     ****************************************************************
 c
@@ -420,7 +457,8 @@ c
      &                              nonlocal_analysis, imatprp,
      &                              initial_stresses,
      &                              initial_state_option,
-     &                              initial_state_step
+     &                              initial_state_step,
+     &                              ls_trial_pass, umat_per_point
       use segmental_curves, only : max_seg_points, max_seg_curves
 c
       implicit none
@@ -433,7 +471,7 @@ c
 c
       integer :: span, felem, matnum, mat_type,
      &           num_enodes, num_enode_dof, totdof, num_int_points,
-     &           elem_type, int_order, cohes_type, surface
+     &           elem_type, int_order, cohes_type, surface, batch_flag
       double precision, parameter :: zero=0.0d0
       integer, external :: omp_get_thread_num
       logical :: geo_non_flg, bbar_flg, tet_elem, tri_elem,
@@ -510,6 +548,11 @@ c
       if( local_work%is_cohes_elem ) local_work%cep_sym_size = 6
       if( local_work%is_umat ) call material_model_info( felem, 0, 3,
      &                                 local_work%umat_stress_type )
+      local_work%umat_batch = .false.
+      if( local_work%is_umat .and. .not. umat_per_point ) then
+        call material_model_info( felem, 0, 5, batch_flag )
+        local_work%umat_batch = batch_flag .eq. 1
+      end if
       local_work%compute_f_bar =  bbar_flg .and.
      &            ( elem_type  .eq. 2 )  .and.
      &            ( local_work%is_umat .or. local_work%is_crys_pls )
@@ -527,6 +570,15 @@ c
      &         step <= initial_state_step
      &         .and. local_work%is_solid_matl
       local_work%capture_initial_state = tflag
+c
+c             line search trial length (ls_trial_pass). only the
+c             element internal forces are wanted. n+1 state is not
+c             scattered to global structures (rplstr) - mnralg
+c             re-runs the accepted length as a full pass.
+c
+      local_work%ls_trial = ls_trial_pass .and. iter > 0
+      if( local_work%ls_trial )
+     &    local_work%capture_initial_state = .false.
 
 c
 c             See if we're actually an interface damaged material
@@ -594,8 +646,10 @@ c
          write(out,9200) blk, span, felem, geo_non_flg
       end if
 c
+      call cep_blk_expand( blk )
       call rknstr( props(1,felem), lprops(1,felem),
      &             iprops(1,felem), local_work )
+      call cep_blk_compact( blk )
 c
 c            get the cut step size flag for the block based
 c            on material model computations. set passed in value
@@ -616,7 +670,8 @@ c            data structures. blocks being processed in parallel can
 c            access these data structures w/o conflict.
 c
       if( local_debug ) write(out,9520) blk, span, felem
-      call rplstr( span, felem, num_int_points, mat_type, iter,
+      if( .not. local_work%ls_trial )
+     &  call rplstr( span, felem, num_int_points, mat_type, iter,
      &             geo_non_flg, local_work, blk, block_stress_sums,
      &             block_strain_sums, local_debug_sums )
       if( local_debug ) write(out,9522) blk, span, felem
@@ -4,7 +4,7 @@ c     *  drive Pardiso solver for symmetric equations: direct or     *
 c     *  iterative. Pardiso is threads only. CPardiso is MPI +       *
 c     *  threads                                                     *
 c     *                                                              *
-c     *      last modified : 11/18/2019 rhd                          *
+c     *      last modified : 10/19/2026 agent                        *
 c     *                                                              *
 c     ****************************************************************
 c
@@ -15,7 +15,8 @@ c
      &                        solver_scr_dir, solver_mkl_iterative )
 c
       use performance_data, only : t_performance_start_pardiso,
-     &                             t_performance_end_pardiso
+     &                             t_performance_end_pardiso,
+     &                             t_auto_solver_record
       use  global_data, only : ltmstp, solver_threads, num_threads
 c
       implicit none
@@ -37,7 +38,8 @@ c
       logical :: use_non_pardiso
       integer ::  mkl_ooc_flag, local_now_step
       double precision, parameter :: zero = 0.d0
-      double precision :: min_diagonal, max_diagonal
+      double precision :: min_diagonal, max_diagonal, wtime
+      double precision, external :: omp_get_wtime
       save num_calls, pardiso_mat_defined
 c
 c                local for pardiso
@@ -58,6 +60,9 @@ c                 2 - Solution of above same matrix equations
 c                     with a new set of coefficients but same
 c                     sparsity
 c                 3 - no solution. just release data.
+c                 4 - direct only. forward/backward solve of a new
+c                     rhs with the factors from the last itype 1/2
+c                     call (arc-length load vector).
 c
       call t_performance_start_pardiso
       use_iterative = solver_mkl_iterative
@@ -91,6 +96,8 @@ c
         if( direct_solve )  call pardiso_symmetric_direct
       case( 3 )
         call pardiso_symmetric_release
+      case( 4 )
+        call pardiso_symmetric_resolve
       case default ! then die
         call warp3d_pardiso_mess( 11, out, error, mkl_ooc_flag,
      &                            print_cpu_stats, iparm )
@@ -383,6 +390,7 @@ c
 c
       num_calls = num_calls + 1
       call thyme( 25, 1 )
+      wtime     = omp_get_wtime()
       phase     = 23 ! iterative solve for displ
       iparm(4)  = 52
       call warp3d_pardiso_mess( 9, out,  error, mkl_ooc_flag,
@@ -392,6 +400,8 @@ c
      &   msglvl, rhs, sol_vec, error )
       call warp3d_pardiso_mess( 8, out, error, mkl_ooc_flag,
      &                          print_cpu_stats, iparm )
+      call t_auto_solver_record( 2, omp_get_wtime() - wtime,
+     &                           iparm(20) )
       call thyme( 25, 2 )
       return
 c
@@ -405,10 +415,14 @@ c
       implicit none
 c
 c              direct solve: factorization, forward/backward pass
-c              combine into one operation.
+c              combine into one operation. iparm(4) is reset in
+c              case solution technique auto has just switched
+c              from iterative.
 c
       num_calls = num_calls + 1
       call thyme( 26, 1 )
+      wtime    = omp_get_wtime()
+      iparm(4) = 0 ! no iterative-direct algorithm
       iparm(8) = 0 ! max numbers of iterative refinement steps
       phase = 23   ! only forward/backward solve
       CALL pardiso( pt, maxfct, mnum, mtype, phase, neq,
@@ -416,11 +430,40 @@ c
      &              iparm, msglvl, rhs, sol_vec, error )
       call warp3d_pardiso_mess( 5, out, error, mkl_ooc_flag,
      &                          print_cpu_stats, iparm )
+      call t_auto_solver_record( 1, omp_get_wtime() - wtime, 0 )
       call thyme( 26, 2 )
 c
       return
 c
       end subroutine pardiso_symmetric_direct
+c
+c     ******************************************************************
+c     *       contains:   pardiso_symmetric_resolve                    *
+c     ******************************************************************
+c
+      subroutine pardiso_symmetric_resolve
+      implicit none
+c
+c              phase 33 only - factors stay from the last direct
+c              solve. k_pointers, k_indices, eqn_coeffs must still
+c              hold that (mapped) matrix.
+c
+      if( use_iterative .or. .not. pardiso_mat_defined )
+     &  call warp3d_pardiso_mess( 7, out,
+     &        error, mkl_ooc_flag, print_cpu_stats, iparm )
+      call thyme( 26, 1 )
+      iparm(8) = 0
+      phase = 33
+      call pardiso( pt, maxfct, mnum, mtype, phase, neq,
+     &              eqn_coeffs, k_pointers, k_indices, idum, nrhs,
+     &              iparm, msglvl, rhs, sol_vec, error )
+      if( error .ne. 0 ) call warp3d_pardiso_mess( 5, out, error,
+     &                  mkl_ooc_flag, print_cpu_stats, iparm )
+      call thyme( 26, 2 )
+c
+      return
+c
+      end subroutine pardiso_symmetric_resolve
 c
       end subroutine pardiso_symmetric
 c
@@ -157,6 +157,119 @@ c
      &       '               Gauss integration not defined' )                   
 c                                                                               
       end                                                                       
+c     ****************************************************************
+c     *                                                              *
+c     *                   subroutine gp_shape_lookup                 *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     same results as getgpts + derivs (+ shapef) for one      *
+c     *     integration point but taken from a table built the      *
+c     *     first time the (element type, order) pair is seen.      *
+c     *     the block routines call this for every block on every   *
+c     *     iteration - the polynomial evaluations are now done     *
+c     *     once per run                                             *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine gp_shape_lookup( etype, order, gpn, ngp, nnode,
+     &                            need_shape, xi, eta, zeta, weight,
+     &                            nxi, neta, nzeta, shape )
+      use main_data, only : gp_shape_tables, gp_shape_tables_built
+      implicit none
+      include 'param_def'
+c
+      integer :: etype, order, gpn, ngp, nnode
+      logical :: need_shape
+      double precision :: xi, eta, zeta, weight, nxi(*), neta(*),
+     &                    nzeta(*), shape(*)
+c
+      logical :: built
+c
+c              pairs outside the table range, or a request that does
+c              not match the table, fall back to direct evaluation.
+c
+      if( etype .lt. 1 .or. etype .gt. 19 .or. order .lt. 1 .or.
+     &    order .gt. 9 ) go to 100
+c
+!$OMP ATOMIC READ
+      built = gp_shape_tables_built(etype,order)
+      if( .not. built ) then
+!$OMP CRITICAL (gp_shape_build)
+        if( .not. gp_shape_tables_built(etype,order) ) then
+          call gp_shape_build( etype, order, ngp, nnode )
+!$OMP FLUSH
+!$OMP ATOMIC WRITE
+          gp_shape_tables_built(etype,order) = .true.
+        end if
+!$OMP END CRITICAL (gp_shape_build)
+      end if
+!$OMP FLUSH
+c
+      if( gpn .gt. gp_shape_tables(etype,order)%ngp .or.
+     &    nnode .gt. gp_shape_tables(etype,order)%nnode ) go to 100
+c
+      associate( t => gp_shape_tables(etype,order) )
+      xi     = t%xi(gpn)
+      eta    = t%eta(gpn)
+      zeta   = t%zeta(gpn)
+      weight = t%weights(gpn)
+      nxi(1:nnode)   = t%nxi(1:nnode,gpn)
+      neta(1:nnode)  = t%neta(1:nnode,gpn)
+      nzeta(1:nnode) = t%nzeta(1:nnode,gpn)
+      if( need_shape ) shape(1:nnode) = t%shape(1:nnode,gpn)
+      end associate
+      return
+c
+ 100  continue
+      call getgpts( etype, order, gpn, xi, eta, zeta, weight )
+      call derivs( etype, xi, eta, zeta, nxi, neta, nzeta )
+      if( need_shape ) call shapef( etype, xi, eta, zeta, shape )
+      return
+c
+      contains
+c     ========
+c
+      subroutine gp_shape_build( etype, order, ngp, nnode )
+      implicit none
+c
+      integer :: etype, order, ngp, nnode
+c
+      integer :: i
+      double precision, parameter :: zero = 0.0d0
+c
+c              rows sized mxndel - derivs/shapef fill the node
+c              count implied by etype.
+c
+      associate( t => gp_shape_tables(etype,order) )
+      t%ngp   = ngp
+      t%nnode = nnode
+      allocate( t%xi(ngp), t%eta(ngp), t%zeta(ngp), t%weights(ngp) )
+      allocate( t%shape(mxndel,ngp), t%nxi(mxndel,ngp),
+     &          t%neta(mxndel,ngp), t%nzeta(mxndel,ngp) )
+      t%eta   = zero  ! line3 sets only xi
+      t%zeta  = zero
+      t%shape = zero
+      t%nxi   = zero
+      t%neta  = zero
+      t%nzeta = zero
+c
+      do i = 1, ngp
+        call getgpts( etype, order, i, t%xi(i), t%eta(i), t%zeta(i),
+     &                t%weights(i) )
+        call derivs( etype, t%xi(i), t%eta(i), t%zeta(i), t%nxi(1,i),
+     &               t%neta(1,i), t%nzeta(1,i) )
+        call shapef( etype, t%xi(i), t%eta(i), t%zeta(i),
+     &               t%shape(1,i) )
+      end do
+      end associate
+c
+      return
+      end subroutine gp_shape_build
+c
+      end subroutine gp_shape_lookup
 c     ****************************************************************          
 c     *                                                              *          
 c     *                      subroutine quad1                        *          
@@ -38,7 +38,7 @@ c
      &                    bar_areas_n1(mxvl), bar_volumes(mxvl)    
       double precision, parameter :: one = 1.0d0             
       logical :: include_qbar, geonl, bbar, first, qbar_flag, convert,                            
-     &           temps_to_process, symmetric_assembly
+     &           temps_to_process, symmetric_assembly, solid_b
 c                                                                               
 c                       set local versions of the data structure                
 c                       scalars. set logical to include/not include the         
@@ -233,6 +233,13 @@ c                     note that props(1,felem) passed in above
 c                                                                               
 c
       stiff_type = 1 ! solid, cohesive
+c
+c                     [B] built by blcmp1 without b-bar has 3 non-zero
+c                     terms per column. bdbt_solid uses that structure
+c
+      solid_b = .not. local_work%is_cohes_elem .and.
+     &          .not. local_work%is_axisymm_elem .and.
+     &          .not. bbar .and. totdof .eq. 3*nnode
       if( local_work%is_bar_elem )  stiff_type = 2      
       if( local_work%is_link_elem ) stiff_type = 3
 c     
@@ -243,6 +250,10 @@ c
      &                local_work%bd_block,                                      
      &                local_work%cep, local_work%ek_full, mxvl,                 
      &                mxedof, totdof*totdof, totdof )                           
+          elseif( solid_b ) then  ! symmetric, standard 3-D [B]
+             call bdbt_solid( span, cp, local_work%b_block,
+     &                 local_work%cep, local_work%ek_symm, mxvl,
+     &                 mxedof, utsz, nstr, nnode )
           else   ! symmetric assembly                                               
              call bdbtgen( span, icp, local_work%b_block,                           
      &                 local_work%bd_block,                                     
@@ -1711,6 +1722,123 @@ c
       return                                                                    
       end                                                                       
                                                                                 
+c     ****************************************************************
+c     *                                                              *
+c     *               subroutine bdbt_solid (symmetric only)         *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     add trans([B]) [D] [B] into the upper-triangle element   *
+c     *     stiffnesses for a block of 3-D solid elements. uses      *
+c     *     the fixed sparsity of the linear [B] from blcmp1: each   *
+c     *     column has only 3 non-zero terms (half the work of       *
+c     *     bdbtgen). [D][B] is formed one column at a time in a     *
+c     *     small work array rather than for all columns             *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine bdbt_solid( span, cp, b, d, ek_symm, mxvl, mxedof,
+     &                       utsz, nstr, nnode )
+      implicit none
+c
+c                       parameter declarations
+c
+      integer :: span, mxvl, mxedof, utsz, nstr, nnode, cp(*)
+      double precision ::
+     &   b(mxvl,mxedof,*), ek_symm(span,utsz), d(mxvl,nstr,*)
+c
+c                       locals
+c
+      integer :: i, k, a, col, pos, n2
+      double precision :: db(mxvl,6), bx, by, bz
+c
+c              dofs are ordered u(1:nnode), v(1:nnode), w(1:nnode).
+c              the non-zero terms of [B] for node a are
+c                 u-col: 1 -> Nx, 4 -> Ny, 6 -> Nz
+c                 v-col: 2 -> Ny, 4 -> Nx, 5 -> Nz
+c                 w-col: 3 -> Nz, 5 -> Ny, 6 -> Nx
+c              with Nx = b(i,a,1), Ny = b(i,a,4), Nz = b(i,a,6).
+c
+c              ek(row,col) = trans(B(:,row)) * { [D] B(:,col) }
+c
+      n2 = 2 * nnode
+c
+      do col = 1, 3*nnode
+c
+c                       db = [D] * B(:,col) using 3 terms of B(:,col)
+c
+        if( col .le. nnode ) then
+          a = col
+!DIR$ IVDEP
+          do i = 1, span
+            bx = b(i,a,1)
+            by = b(i,a,4)
+            bz = b(i,a,6)
+            do k = 1, 6
+              db(i,k) = d(i,k,1)*bx + d(i,k,4)*by + d(i,k,6)*bz
+            end do
+          end do
+        elseif( col .le. n2 ) then
+          a = col - nnode
+!DIR$ IVDEP
+          do i = 1, span
+            bx = b(i,a,1)
+            by = b(i,a,4)
+            bz = b(i,a,6)
+            do k = 1, 6
+              db(i,k) = d(i,k,2)*by + d(i,k,4)*bx + d(i,k,5)*bz
+            end do
+          end do
+        else
+          a = col - n2
+!DIR$ IVDEP
+          do i = 1, span
+            bx = b(i,a,1)
+            by = b(i,a,4)
+            bz = b(i,a,6)
+            do k = 1, 6
+              db(i,k) = d(i,k,3)*bz + d(i,k,5)*by + d(i,k,6)*bx
+            end do
+          end do
+        end if
+c
+c                       rows 1 -> col of this column. u, v then w
+c                       rows each use 3 terms of B(:,row)
+c
+        pos = cp(col)
+        do a = 1, min( col, nnode )
+!DIR$ IVDEP
+          do i = 1, span
+            ek_symm(i,pos+a) = ek_symm(i,pos+a)
+     &                       + b(i,a,1)*db(i,1) + b(i,a,4)*db(i,4)
+     &                       + b(i,a,6)*db(i,6)
+          end do
+        end do
+        pos = pos + nnode
+        do a = 1, min( col-nnode, nnode )
+!DIR$ IVDEP
+          do i = 1, span
+            ek_symm(i,pos+a) = ek_symm(i,pos+a)
+     &                       + b(i,a,4)*db(i,2) + b(i,a,1)*db(i,4)
+     &                       + b(i,a,6)*db(i,5)
+          end do
+        end do
+        pos = pos + nnode
+        do a = 1, min( col-n2, nnode )
+!DIR$ IVDEP
+          do i = 1, span
+            ek_symm(i,pos+a) = ek_symm(i,pos+a)
+     &                       + b(i,a,6)*db(i,3) + b(i,a,4)*db(i,5)
+     &                       + b(i,a,1)*db(i,6)
+          end do
+        end do
+      end do
+c
+      return
+      end
+
 c     ****************************************************************          
 c     *                                                              *          
 c     *                      subroutine ctran1                       *          
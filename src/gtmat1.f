@@ -638,7 +638,7 @@ c     *                      subroutine rtcmp1                       *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified : 06/30/91                   *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     this subroutine computes the polar decompostion of the   *
 c     *     deformation gradient into the rotation tensor [R] and a  *
@@ -648,35 +648,94 @@ c     ****************************************************************
 c
 c
 c
-      subroutine rtcmp1(span,f,r)
+      subroutine rtcmp1( span, f, r )
       implicit none
-      integer :: span
       include 'param_def'
+c
+c                       parameter declarations
+c
+      integer :: span
       double precision :: f(mxvl,ndim,*), r(mxvl,ndim,*)
-      double precision, allocatable :: ui(:,:)
+c
+c                       locals. fixed size - 9*mxvl words
 c
       integer :: i
-      allocate( ui(mxvl,nstr) )
-c                       compute the inverse of the right
-c                       stretch tensor.
+      double precision :: c(mxvl,nstr), ev(mxvl,ndim)
+      double precision :: cc1, cc2, cc3, cc4, cc5, cc6, s1, s2, s3,
+     &  iu, iiu, iiiu, a2, b2, c2, d2, ui1, ui2, ui3, ui4, ui5, ui6
+      double precision, parameter :: one = 1.0d0, two = 2.0d0
 c
-      call irscp1( span, f, ui )
+c                       [R] = [F][U]^-1 with [U]^-1 from the
+c                       principal invariants of [U] (Hoger &
+c                       Carlson). same operations as the former
+c                       irscp1 -> ivcmp1 -> evcmp1_new chain but
+c                       one pass over the span after the
+c                       eigenvalues with all intermediates in
+c                       registers and no work arrays allocated.
+c                       evcmp1_new is branch free so both loops
+c                       vectorize.
 c
-c                       compute the rotation tensor.
+c                       metric tensor [C] = trans([F])[F],
+c                       symmetric upper triangular form.
 c
-!DIR$ VECTOR ALIGNED
-      do i= 1,span
-         r(i,1,1)= f(i,1,1)*ui(i,1)+f(i,1,2)*ui(i,2)+f(i,1,3)*ui(i,4)
-         r(i,1,2)= f(i,1,1)*ui(i,2)+f(i,1,2)*ui(i,3)+f(i,1,3)*ui(i,5)
-         r(i,1,3)= f(i,1,1)*ui(i,4)+f(i,1,2)*ui(i,5)+f(i,1,3)*ui(i,6)
-         r(i,2,1)= f(i,2,1)*ui(i,1)+f(i,2,2)*ui(i,2)+f(i,2,3)*ui(i,4)
-         r(i,2,2)= f(i,2,1)*ui(i,2)+f(i,2,2)*ui(i,3)+f(i,2,3)*ui(i,5)
-         r(i,2,3)= f(i,2,1)*ui(i,4)+f(i,2,2)*ui(i,5)+f(i,2,3)*ui(i,6)
-         r(i,3,1)= f(i,3,1)*ui(i,1)+f(i,3,2)*ui(i,2)+f(i,3,3)*ui(i,4)
-         r(i,3,2)= f(i,3,1)*ui(i,2)+f(i,3,2)*ui(i,3)+f(i,3,3)*ui(i,5)
-         r(i,3,3)= f(i,3,1)*ui(i,4)+f(i,3,2)*ui(i,5)+f(i,3,3)*ui(i,6)
+!DIR$ IVDEP
+      do i = 1, span
+       c(i,1)= f(i,1,1)*f(i,1,1)+f(i,2,1)*f(i,2,1)+f(i,3,1)*f(i,3,1)
+       c(i,2)= f(i,1,1)*f(i,1,2)+f(i,2,1)*f(i,2,2)+f(i,3,1)*f(i,3,2)
+       c(i,3)= f(i,1,2)*f(i,1,2)+f(i,2,2)*f(i,2,2)+f(i,3,2)*f(i,3,2)
+       c(i,4)= f(i,1,1)*f(i,1,3)+f(i,2,1)*f(i,2,3)+f(i,3,1)*f(i,3,3)
+       c(i,5)= f(i,1,2)*f(i,1,3)+f(i,2,2)*f(i,2,3)+f(i,3,2)*f(i,3,3)
+       c(i,6)= f(i,1,3)*f(i,1,3)+f(i,2,3)*f(i,2,3)+f(i,3,3)*f(i,3,3)
       end do
 c
+      call evcmp1_new( span, mxvl, c, ev )
+c
+!DIR$ IVDEP
+      do i = 1, span
+c
+c                       [C]^2
+c
+       cc1 = c(i,1)*c(i,1)+c(i,2)*c(i,2)+c(i,4)*c(i,4)
+       cc2 = c(i,1)*c(i,2)+c(i,2)*c(i,3)+c(i,4)*c(i,5)
+       cc3 = c(i,2)*c(i,2)+c(i,3)*c(i,3)+c(i,5)*c(i,5)
+       cc4 = c(i,1)*c(i,4)+c(i,2)*c(i,5)+c(i,4)*c(i,6)
+       cc5 = c(i,2)*c(i,4)+c(i,3)*c(i,5)+c(i,5)*c(i,6)
+       cc6 = c(i,4)*c(i,4)+c(i,5)*c(i,5)+c(i,6)*c(i,6)
+c
+c                       principal stretches, invariants of [U]
+c
+       s1   = sqrt( ev(i,1) )
+       s2   = sqrt( ev(i,2) )
+       s3   = sqrt( ev(i,3) )
+       iu   = s1 + s2 + s3
+       iiu  = s1*s2 + s2*s3 + s1*s3
+       iiiu = s1*s2*s3
+c
+c                       [U]^-1
+c
+       a2 = one / ( iiiu*(iu*iiu-iiiu) )
+       b2 = iu*iiu*iiu - iiiu*(iu*iu+iiu)
+       c2 = -iiiu - iu*(iu*iu-two*iiu)
+       d2 = iu
+       ui1 = a2 * ( b2 + c2*c(i,1) + d2*cc1 )
+       ui2 = a2 * (      c2*c(i,2) + d2*cc2 )
+       ui3 = a2 * ( b2 + c2*c(i,3) + d2*cc3 )
+       ui4 = a2 * (      c2*c(i,4) + d2*cc4 )
+       ui5 = a2 * (      c2*c(i,5) + d2*cc5 )
+       ui6 = a2 * ( b2 + c2*c(i,6) + d2*cc6 )
+c
+c                       [R] = [F][U]^-1
+c
+       r(i,1,1)= f(i,1,1)*ui1+f(i,1,2)*ui2+f(i,1,3)*ui4
+       r(i,1,2)= f(i,1,1)*ui2+f(i,1,2)*ui3+f(i,1,3)*ui5
+       r(i,1,3)= f(i,1,1)*ui4+f(i,1,2)*ui5+f(i,1,3)*ui6
+       r(i,2,1)= f(i,2,1)*ui1+f(i,2,2)*ui2+f(i,2,3)*ui4
+       r(i,2,2)= f(i,2,1)*ui2+f(i,2,2)*ui3+f(i,2,3)*ui5
+       r(i,2,3)= f(i,2,1)*ui4+f(i,2,2)*ui5+f(i,2,3)*ui6
+       r(i,3,1)= f(i,3,1)*ui1+f(i,3,2)*ui2+f(i,3,3)*ui4
+       r(i,3,2)= f(i,3,1)*ui2+f(i,3,2)*ui3+f(i,3,3)*ui5
+       r(i,3,3)= f(i,3,1)*ui4+f(i,3,2)*ui5+f(i,3,3)*ui6
+      end do
 c
       return
       end
@@ -903,78 +962,6 @@ c
 c
 c     ****************************************************************
 c     *                                                              *
-c     *                      subroutine irscp1                       *
-c     *                                                              *
-c     *                       written by : bh                        *
-c     *                                                              *
-c     *                   last modified : 1/1/2018 rhd               *
-c     *                                                              *
-c     *     this subroutine computes the inverse of the right        *
-c     *     stretch tensor. the computations are for a gauss         *
-c     *     point for a block of solid elements                      *
-c     *                                                              *
-c     ****************************************************************
-c
-c
-c
-      subroutine irscp1( span, f, ui )
-      implicit none
-      include 'param_def'
-c
-c                       parameter declarations
-c
-      integer :: span
-      double precision :: f(mxvl,ndim,*), ui(mxvl,*)
-c
-c                       locally allocated arrays
-c
-      integer :: i
-      double precision, allocatable ::
-     &   c(:,:), cc(:,:),
-     &   iu(:), iiu(:), iiiu(:), a2(:), b2(:),
-     &   c2(:),d2(:)
-      double precision, parameter :: one = 1.0d0, two = 2.0d0
-c
-      allocate (
-     &   c(mxvl,nstr), cc(mxvl,nstr),
-     &   iu(mxvl), iiu(mxvl), iiiu(mxvl), a2(mxvl), b2(mxvl),
-     &   c2(mxvl),d2(mxvl) )
-c
-c                       ui is in symmetric upper triangular form.
-c
-c                       compute the invariants of the right
-c                       stretch tensor, the metric tensor, and
-c                       its square.
-c
-      call ivcmp1( span, f, c, cc, iu, iiu, iiiu )
-c
-c                       compute multipliers.
-c
-!DIR$ VECTOR ALIGNED
-      do i = 1, span
-         a2(i)= one/(iiiu(i)*(iu(i)*iiu(i)-iiiu(i)))
-         b2(i)= iu(i)*iiu(i)*iiu(i)-iiiu(i)*(iu(i)*iu(i)+iiu(i))
-         c2(i)= -iiiu(i)-iu(i)*(iu(i)*iu(i)-two*iiu(i))
-         d2(i)= iu(i)
-      end do
-c
-c                       compute the inverse of the right
-c                       stretch tensor.
-c
-!DIR$ VECTOR ALIGNED
-      do i = 1, span
-         ui(i,1)= a2(i) * ( b2(i) + c2(i)*c(i,1) + d2(i)*cc(i,1) )
-         ui(i,2)= a2(i) * (         c2(i)*c(i,2) + d2(i)*cc(i,2) )
-         ui(i,3)= a2(i) * ( b2(i) + c2(i)*c(i,3) + d2(i)*cc(i,3) )
-         ui(i,4)= a2(i) * (         c2(i)*c(i,4) + d2(i)*cc(i,4) )
-         ui(i,5)= a2(i) * (         c2(i)*c(i,5) + d2(i)*cc(i,5) )
-         ui(i,6)= a2(i) * ( b2(i) + c2(i)*c(i,6) + d2(i)*cc(i,6) )
-      end do
-c
-      return
-      end
-c     ****************************************************************
-c     *                                                              *
 c     *                      subroutine ivcmp1                       *
 c     *                                                              *
 c     *                       written by : bh                        *
@@ -1085,7 +1072,7 @@ c     *                      subroutine evcmp1_new                   *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 09/6/2016                  *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     eigenvalues of metric tensor. symmetric, real 3x3
 c     *                                                              *
@@ -1103,8 +1090,7 @@ c                 locals
 c
       integer :: bel
       double precision ::
-     &  m11, m12, m13, m22, m23, m33, e1, e2, e3,
-     &  swap1, swap2, swap3,
+     &  m11, m12, m13, m22, m23, m33, e2,
      &  de, dd, ee, ff, m, c1, c0,p, q, sqrtp,phi, cphi, sphi
 
       double precision, parameter ::
@@ -1121,6 +1107,7 @@ c              are accessed. The access is read-only.
 c              Copyright (C) 2006  Joachim Kopp. Avialble under
 c              GNU Lesser General Public License
 c
+!DIR$ IVDEP
       do bel = 1, span
        m11 = c(bel,1)
        m12 = c(bel,2)
@@ -1143,32 +1130,16 @@ c
        phi = third * atan2(sqrt(abs(phi)), q)
        cphi = sqrtp * cos(phi)
        sphi = oneroot3 * sqrtp * sin(phi)
-       e2 = third * (m - cphi)
-       e3 = e2 + sphi
-       e1 = e2 + cphi
-       e2 = e2 - sphi
-c
-       if( e2 .lt. e1 ) then
-            swap1 = e1
-            e1    = e2
-            e2    = swap1
-       end if
-c
-       if( e3 .lt. e1 ) then
-            swap2 = e1
-            e1    = e3
-            e3    = swap2
-       end if
 c
-       if( e3 .lt. e2 ) then
-            swap3 = e2
-            e2    = e3
-            e3    = swap3
-       end if
+c              phi lies in [0,pi/3] so cphi >= sphi >= 0. the
+c              roots come out already in ascending order - no
+c              swaps needed and the loop stays branch free.
+c              repeated roots give p = 0 -> all = m/3.
 c
-       lamda(bel,1) = e1
-       lamda(bel,2) = e2
-       lamda(bel,3) = e3
+       e2 = third * (m - cphi)
+       lamda(bel,1) = e2 - sphi
+       lamda(bel,2) = e2 + sphi
+       lamda(bel,3) = e2 + cphi
 c
       end do
 c
@@ -1176,6 +1147,180 @@ c
       end
 
 
+c     ****************************************************************
+c     *                                                              *
+c     *                      subroutine evcmp1_vectors               *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     eigenvalues (ascending) and unit eigenvectors of a       *
+c     *     span of symmetric, real 3x3 matrices. closed form -      *
+c     *     replaces calls to ou3dpr one point at a time             *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine evcmp1_vectors( span, mxvl, c, lamda, evec )
+      implicit none
+c
+c                 parameter declarations
+c
+      integer :: span, mxvl
+      double precision :: c(mxvl,6), lamda(mxvl,3), evec(mxvl,3,3)
+c
+c                 locals
+c
+      integer :: bel, k, ier, pass
+      logical :: fallback(mxvl), any_fallback
+      double precision :: lam, s, r1x, r1y, r1z, r2x, r2y, r2z, r3x,
+     &  r3y, r3z, ax, ay, az, bx, by, bz, cx, cy, cz, na, nb, nc,
+     &  vx, vy, vz, vn, vp, tc(6), wk(3), ev(3), z(3,3)
+      double precision, parameter :: zero = 0.0d0, one = 1.0d0,
+     &  two = 2.0d0, tol = 1.0d-04
+c
+c              c is in symmetric storage mode (11,12,22,13,23,33) -
+c              the same layout ou3dpr uses.
+c
+c              eigenvalues by Cardano. eigenvectors for the smallest
+c              and largest roots are the largest cross product of
+c              two rows of [c - lam I]; the middle vector completes
+c              the right-handed set. when a root is (nearly)
+c              repeated the cross products vanish and the vector is
+c              not well defined by this route - those points fall
+c              back to ou3dpr. a zero matrix gives the identity.
+c
+c              sign convention: the largest magnitude component of
+c              vectors 1 and 3 is positive and vector 2 = 3 x 1.
+c              ou3dpr has no convention of its own - its signs fall
+c              out of the Householder/QL sequence and about half its
+c              triads are left handed - so its vectors are put in
+c              the same form for the fallback points.
+c
+      call evcmp1_new( span, mxvl, c, lamda )
+c
+      do bel = 1, span
+        fallback(bel) = .false.
+      end do
+c
+c              pass 2 repeats the vectors using Rayleigh quotients
+c              from pass 1. Cardano roots lose digits as phi nears
+c              0 or pi/3; the quotients are accurate to ~ (vector
+c              error)**2.
+c
+      do pass = 1, 2
+      do k = 1, 3, 2
+!DIR$ IVDEP
+       do bel = 1, span
+        lam = lamda(bel,k)
+        s   = max( abs(lamda(bel,1)), abs(lamda(bel,3)) )
+        r1x = c(bel,1) - lam
+        r1y = c(bel,2)
+        r1z = c(bel,4)
+        r2x = c(bel,2)
+        r2y = c(bel,3) - lam
+        r2z = c(bel,5)
+        r3x = c(bel,4)
+        r3y = c(bel,5)
+        r3z = c(bel,6) - lam
+        ax  = r1y*r2z - r1z*r2y
+        ay  = r1z*r2x - r1x*r2z
+        az  = r1x*r2y - r1y*r2x
+        bx  = r1y*r3z - r1z*r3y
+        by  = r1z*r3x - r1x*r3z
+        bz  = r1x*r3y - r1y*r3x
+        cx  = r2y*r3z - r2z*r3y
+        cy  = r2z*r3x - r2x*r3z
+        cz  = r2x*r3y - r2y*r3x
+        na  = ax*ax + ay*ay + az*az
+        nb  = bx*bx + by*by + bz*bz
+        nc  = cx*cx + cy*cy + cz*cz
+        vx  = merge( ax, bx, na .ge. nb )
+        vy  = merge( ay, by, na .ge. nb )
+        vz  = merge( az, bz, na .ge. nb )
+        vn  = max( na, nb )
+        vx  = merge( cx, vx, nc .gt. vn )
+        vy  = merge( cy, vy, nc .gt. vn )
+        vz  = merge( cz, vz, nc .gt. vn )
+        vn  = max( vn, nc )
+        if( s .eq. zero ) then
+          vx = zero
+          vy = zero
+          vz = zero
+          if( k .eq. 1 ) vx = one
+          if( k .eq. 3 ) vz = one
+          vn = one
+        else if( vn .le. tol * s**4 ) then
+          fallback(bel) = .true.
+          vn = one
+        end if
+        vp = merge( vx, merge( vy, vz, abs(vy) .ge. abs(vz) ),
+     &              abs(vx) .ge. abs(vy) .and. abs(vx) .ge. abs(vz) )
+        vn = sign( one / sqrt( vn ), vp )
+        evec(bel,1,k) = vx * vn
+        evec(bel,2,k) = vy * vn
+        evec(bel,3,k) = vz * vn
+       end do
+      end do
+c
+!DIR$ IVDEP
+      do bel = 1, span
+        evec(bel,1,2) = evec(bel,2,3)*evec(bel,3,1) -
+     &                  evec(bel,3,3)*evec(bel,2,1)
+        evec(bel,2,2) = evec(bel,3,3)*evec(bel,1,1) -
+     &                  evec(bel,1,3)*evec(bel,3,1)
+        evec(bel,3,2) = evec(bel,1,3)*evec(bel,2,1) -
+     &                  evec(bel,2,3)*evec(bel,1,1)
+      end do
+c
+      do k = 1, 3
+!DIR$ IVDEP
+       do bel = 1, span
+        vx = evec(bel,1,k)
+        vy = evec(bel,2,k)
+        vz = evec(bel,3,k)
+        lamda(bel,k) = c(bel,1)*vx*vx + c(bel,3)*vy*vy +
+     &                 c(bel,6)*vz*vz + two*( c(bel,2)*vx*vy +
+     &                 c(bel,4)*vx*vz + c(bel,5)*vy*vz )
+       end do
+      end do
+      end do  ! pass
+c
+      any_fallback = .false.
+      do bel = 1, span
+        any_fallback = any_fallback .or. fallback(bel)
+      end do
+      if( .not. any_fallback ) return
+c
+c              (nearly) repeated roots. general QL routine for
+c              just these points.
+c
+      do bel = 1, span
+        if( .not. fallback(bel) ) cycle
+        tc(1:6) = c(bel,1:6)
+        call ou3dpr( tc, 3, 1, ev, z, 3, wk, ier )
+        lamda(bel,1:3)  = ev(1:3)
+        do k = 1, 3, 2
+          vx = z(1,k)
+          vy = z(2,k)
+          vz = z(3,k)
+          vp = merge( vx, merge( vy, vz, abs(vy) .ge. abs(vz) ),
+     &                abs(vx) .ge. abs(vy) .and. abs(vx) .ge. abs(vz) )
+          vn = sign( one, vp )
+          evec(bel,1,k) = vx * vn
+          evec(bel,2,k) = vy * vn
+          evec(bel,3,k) = vz * vn
+        end do
+        evec(bel,1,2) = evec(bel,2,3)*evec(bel,3,1) -
+     &                  evec(bel,3,3)*evec(bel,2,1)
+        evec(bel,2,2) = evec(bel,3,3)*evec(bel,1,1) -
+     &                  evec(bel,1,3)*evec(bel,3,1)
+        evec(bel,3,2) = evec(bel,1,3)*evec(bel,2,1) -
+     &                  evec(bel,2,3)*evec(bel,1,1)
+      end do
+c
+      return
+      end
 c     ****************************************************************
 c     *                                                              *
 c     *                      subroutine evcmp1                       *
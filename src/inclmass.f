@@ -54,7 +54,7 @@ c     *                  subroutine inclmass_blk                     *
 c     *                                                              *          
 c     *                       written by : rhd                       *          
 c     *                                                              *          
-c     *                   last modified : rhd 3/16/2017 rhd         *           
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *          
 c     *     process a block for updating element stiffness with      *          
 c     *     effective mass for newmark integration                   *          
@@ -97,6 +97,7 @@ c
       num_enode = iprops(2,felem)                                               
       totdof    = 3 * num_enode                                                 
       span      = elblks(0,blk)                                                 
+      call estiff_blk_expand( blk, .true. )
       emat      => estiff_blocks(blk)%ptr                                       
       mmat      => mass_blocks(blk)%ptr                                         
 c                                                                               
@@ -129,5 +130,7 @@ c
            end do                                                               
       end if                                                                    
 c                                                                               
+      call estiff_blk_compact( blk )
+c
       return                                                                    
       end                                                                       
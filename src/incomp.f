@@ -4,7 +4,7 @@ c     *                      subroutine incomp                       *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified : 6/15/2013 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     performs the initial computations, data structure setup  *
 c     *     necessary for first (time) step i                        *
@@ -215,3 +215,201 @@ c
      & '>> tied mesh processor finished  @ ', f10.2)
 c
       end
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine incomp_reset_solution             *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     return the solution to the unloaded state before step 1  *
+c     *     while keeping the model, blocking and solver setup.      *
+c     *     supports running a series of analysis cases (load        *
+c     *     scales, temperatures) in one input file                  *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine incomp_reset_solution
+      use global_data ! old common.main
+      use main_data, only : rload, rload_nm1, dload, pbar,
+     &                      total_user_nodal_forces,
+     &                      load_pattern_factors, eq_node_forces,
+     &                      temper_nodes, temper_nodes_ref,
+     &                      temper_elems, dtemp_nodes, dtemp_elems,
+     &                      du_nm1, du_prior_valid, arc_radius,
+     &                      arc_lambda, convergence_history,
+     &                      release_cons_table, nonlocal_analysis,
+     &                      initial_state_option,
+     &                      initial_stresses_input,
+     &                      initial_stresses_user_routine,
+     &                      ifv_state_valid, solution_was_reset
+      use elem_block_data, only : history_blocks, history1_blocks,
+     &                            cep_blocks, cep_blocks_sp,
+     &                            eps_n_blocks, eps_n1_blocks,
+     &                            urcs_n_blocks, urcs_n1_blocks,
+     &                            rot_n_blocks, rot_n1_blocks,
+     &                            element_vol_blocks, estiff_blk_frozen
+      use damage_data, only : growth_by_kill, growth_by_release
+c
+      implicit none
+c
+      integer :: blk, i, k, n
+      double precision, parameter :: zero = 0.0d0, one = 1.0d0
+      double precision :: rot_init(9)
+      character(len=40) :: why
+c
+c          the model (nodes, elements, properties, constraints,
+c          loading definitions), element blocking, the mass, the
+c          equation sparsity and the solver ordering/symbolic
+c          factorization all stay. the next compute command starts
+c          at step 1 and re-uses them (incomp does not run again).
+c          solution state goes back to the incomp values: zero
+c          displacements, velocities, accelerations, strains,
+c          stresses, material histories and [D]s; unit rotations;
+c          temperatures at the reference values. initial velocity
+c          or temperature conditions may be given again before the
+c          next compute. the element properties stay as well, so
+c          material input after the reset is rejected (inmat).
+c
+c          cases where the state is not only in the data below are
+c          not supported: MPI (worker ranks own blocks), crack
+c          growth, nonlocal shared values, initial stresses/state
+c          and constraint release.
+c
+      if( .not. incflg ) then
+        write(out,9010)
+        return
+      end if
+c
+      why = ' '
+      if( use_mpi ) why = 'MPI execution'
+      if( growth_by_kill .or. growth_by_release ) why = 'crack growth'
+      if( nonlocal_analysis ) why = 'nonlocal analysis'
+      if( initial_state_option .or. initial_stresses_input .or.
+     &    initial_stresses_user_routine )
+     &    why = 'initial stresses or initial state'
+      if( allocated( release_cons_table ) ) why = 'released constraints'
+      if( why .ne. ' ' ) then
+        write(out,9000) trim( why )
+        num_error = num_error + 1
+        return
+      end if
+c
+c          global solution vectors, energies, step counters
+c
+      u(1:nodof)   = zero
+      v(1:nodof)   = zero
+      a(1:nodof)   = zero
+      du(1:nodof)  = zero
+      idu(1:nodof) = zero
+      load(1:nodof) = zero
+      res(1:nodof) = zero
+      ifv(1:nodof) = zero
+      ltmstp           = 0
+      lsldnm           = ' '
+      total_model_time = zero
+      ext_work         = zero
+      internal_energy  = zero
+      plastic_work     = zero
+      killed_ele_pls_work = zero
+      killed_ele_int_work = zero
+      sum_ifv          = zero
+      sum_loads        = zero
+      scaling_adapt    = one
+c
+      if( allocated( rload ) ) rload = zero
+      if( allocated( rload_nm1 ) ) rload_nm1 = zero
+      if( allocated( dload ) ) dload = zero
+      if( allocated( pbar ) ) pbar = zero
+      if( allocated( total_user_nodal_forces ) )
+     &    total_user_nodal_forces = zero
+      if( allocated( load_pattern_factors ) )
+     &    load_pattern_factors = zero
+      if( allocated( eq_node_forces ) ) eq_node_forces = zero
+      if( allocated( du_nm1 ) ) du_nm1 = zero
+      if( allocated( temper_nodes ) )
+     &    temper_nodes(1:nonode) = temper_nodes_ref(1:nonode)
+      if( allocated( temper_elems ) ) temper_elems = zero
+      if( allocated( dtemp_nodes ) ) dtemp_nodes = zero
+      if( allocated( dtemp_elems ) ) dtemp_elems = zero
+      du_prior_valid  = .false.
+      ifv_state_valid = .false.
+      solution_was_reset = .true.
+      arc_radius      = zero
+      arc_lambda      = one
+      do i = 1, 5
+       convergence_history(i)%step_converged = .false.
+       convergence_history(i)%adaptive_used = .false.
+       convergence_history(i)%iterations_for_convergence = 0
+       convergence_history(i)%adapt_substeps = 0
+      end do
+c
+c          mm10 reduced-order crystal groups back to the groups
+c          from the initial orientations
+c
+      call mm10_cluster_rebuild
+c
+c          element block data. stored element stiffnesses are no
+c          longer for the current state.
+c
+      rot_init(1:9) = zero
+      rot_init(1)   = one
+      rot_init(5)   = one
+      rot_init(9)   = one
+c
+      do blk = 1, nelblk
+        if( allocated( history_blocks ) ) then
+          if( associated( history_blocks(blk)%ptr ) )
+     &        history_blocks(blk)%ptr = zero
+          if( associated( history1_blocks(blk)%ptr ) )
+     &        history1_blocks(blk)%ptr = zero
+        end if
+        if( allocated( cep_blocks ) ) then
+          if( allocated( cep_blocks(blk)%vector ) )
+     &        cep_blocks(blk)%vector = zero
+        end if
+        if( allocated( cep_blocks_sp ) ) then
+          if( allocated( cep_blocks_sp(blk)%vector ) )
+     &        cep_blocks_sp(blk)%vector = 0.0
+        end if
+        if( allocated( eps_n_blocks ) ) then
+          if( associated( eps_n_blocks(blk)%ptr ) )
+     &        eps_n_blocks(blk)%ptr = zero
+          if( associated( eps_n1_blocks(blk)%ptr ) )
+     &        eps_n1_blocks(blk)%ptr = zero
+        end if
+        if( allocated( urcs_n_blocks ) ) then
+          if( associated( urcs_n_blocks(blk)%ptr ) )
+     &        urcs_n_blocks(blk)%ptr = zero
+          if( associated( urcs_n1_blocks(blk)%ptr ) )
+     &        urcs_n1_blocks(blk)%ptr = zero
+        end if
+        if( allocated( element_vol_blocks ) ) then
+          if( associated( element_vol_blocks(blk)%ptr ) )
+     &        element_vol_blocks(blk)%ptr = zero
+        end if
+        if( allocated( estiff_blk_frozen ) )
+     &      estiff_blk_frozen(blk) = .false.
+        if( .not. allocated( rot_n_blocks ) ) cycle
+        if( .not. associated( rot_n_blocks(blk)%ptr ) ) cycle
+        n = size( rot_n_blocks(blk)%ptr ) / 9
+        do k = 0, n-1
+          rot_n_blocks(blk)%ptr(9*k+1:9*k+9)  = rot_init(1:9)
+          rot_n1_blocks(blk)%ptr(9*k+1:9*k+9) = rot_init(1:9)
+        end do
+      end do
+c
+      write(out,9100)
+c
+      return
+c
+ 9000 format(/1x,'>>>>> error: reset solution is not available with ',
+     &       a,/)
+ 9010 format(/1x,'>>>>> warning: reset solution. no solution yet -',
+     &       ' nothing to reset',/)
+ 9100 format(/,7x,
+     & '>> solution reset to the unloaded state before step 1.',
+     & /,7x,'   model, blocking and solver setup are kept',/)
+c
+      end
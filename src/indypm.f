@@ -5,7 +5,7 @@ c     *                      subroutine indypm                       *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified : 12/3/2019 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     input parameters controlling how the solution is         *
 c     *     performed for analysis                                   *
@@ -24,10 +24,17 @@ c
      &                      asymmetric_assembly, matprp, 
      &                      batch_mess_fname, extrapolate,
      &                      extrap_off_next_step, line_search,
-     &                      ls_details, ls_min_step_length,
+     &                      extrap_quadratic,
+     &                      ls_details, ls_cheap_trials,
+     &                      ls_min_step_length,
      &                      ls_max_step_length, ls_rho,
-     &                      ls_slack_tol, umat_serial,
-     &                      initial_state_option, initial_state_step
+     &                      ls_slack_tol, umat_serial, umat_per_point,
+     &                      deterministic_ifv, estiff_single_prec,
+     &                      cep_single_prec, adapt_target_iters,
+     &                      initial_state_option, initial_state_step,
+     &                      arc_length, arc_target_iters, arc_radius,
+     &                      explicit_dynamics, explicit_dt_fraction,
+     &                      solver_auto, anderson_accel, anderson_depth
       use hypre_parameters
       use performance_data
       use distributed_stiffness_data, only : parallel_assembly_allowed,
@@ -44,7 +51,7 @@ c
       double precision ::  dnum, dumd
       double precision, parameter :: zero = 0.0d00
       logical :: lstflg, msg_flag, local_direct_flag,
-     &           local_direct
+     &           local_direct, local_single
       logical, external :: matchs, integr, endcrd, true, numd, numr,
      &                     string, numi, label, matchs_exact, match
       character(len=1) :: dums
@@ -100,6 +107,10 @@ c
       if( matchs('divergence',5)    ) go to 3400
       if( matchs_exact('line')      ) go to 3500 ! line search
       if( matchs_exact('initial')   ) go to 3600 ! state
+      if( matchs_exact('storage')   ) go to 3700 ! precision
+      if( matchs_exact('arc')       ) go to 3800 ! length
+      if( matchs_exact('explicit')  ) go to 3900 ! dynamics
+      if( matchs_exact('anderson')  ) go to 4000 ! acceleration
 c
 c                       no match with solutions parameters command.
 c                       return to driver subroutine to look for high
@@ -185,6 +196,11 @@ c
       else
          call errmsg(174,dum,dums,dumr,dumd)
       end if
+      if( matchs('quadratic',4) ) then
+         extrap_quadratic = .true.
+      else if( matchs('linear',3) ) then
+         extrap_quadratic = .false.
+      end if
       if( endcrd() ) go to 10
       if( matchs('next',2) ) then
          extrap_off_next_step = .true.
@@ -433,6 +449,7 @@ c
       end if
       solver_flag = 0
       solver_mkl_iterative = .false.
+      solver_auto = .false.
       local_direct_flag = .false.
       if ( matchs('technique',4) ) call splunj
       if ( matchs('type',4) ) call splunj
@@ -490,6 +507,17 @@ c        end if
         end if
       end if
 c
+c                 Pardiso with automatic direct <-> iterative
+c                 switching at step boundaries (see mnralg). starts
+c                 direct.
+c
+      if( matchs_exact('auto') ) then
+         solver_flag = 7
+         solver_mkl_iterative = .false.
+         solver_auto = .true.
+         go to 1150
+      end if
+c
 c                 Pardiso sparse iterative
 c
       if ( matchs('iterative',8)) then
@@ -610,6 +638,12 @@ c **********************************************************************
 c *                                                                    *
 c *                     adaptive solution for static problems          *
 c *                                                                    *
+c *     adaptive solution on | off  < target iterations <n> >          *
+c *                                                                    *
+c *     with a target > 0 each step starts already subdivided when     *
+c *     the prior step needed many more (or fewer) newton iterations   *
+c *     than the target. see adapt_check. 0 turns this off.            *
+c *                                                                    *
 c **********************************************************************
 c
 c
@@ -617,6 +651,15 @@ c
       if( matchs('solution',3) ) call splunj
       if( matchs('on',      2) ) adaptive_flag = .true.
       if( matchs('off',     2) ) adaptive_flag = .false.
+      if( matchs('target',4) ) then
+        if( matchs('iterations',4) ) call splunj
+        if( .not. numi( adapt_target_iters ) ) then
+          write(out,9590)
+          num_error = num_error + 1
+          adapt_target_iters = 0
+        end if
+        if( adapt_target_iters .lt. 0 ) adapt_target_iters = 0
+      end if
       go to 10
 c
 c
@@ -1113,6 +1156,12 @@ c **********************************************************************
 c *                                                                    *
 c *                set umat routine to run serial or not               *
 c *                                                                    *
+c *     umat serial on | off                                           *
+c *     umat batch on | off                                            *
+c *                                                                    *
+c *     batch off calls umat point by point even when                  *
+c *     umat_set_features asks for umat_batch (info_vector(5) = 1)     *
+c *                                                                    *
 c **********************************************************************
 c
 c
@@ -1125,6 +1174,14 @@ c
         else
            call errmsg(343,dum,dums,dumr,dumd)
         end if
+      else if( matchs("batch",5) ) then
+        if (matchs('on',2)) then
+           umat_per_point = .false.
+        else if (matchs('off',3)) then
+           umat_per_point = .true.
+        else
+           call errmsg(343,dum,dums,dumr,dumd)
+        end if
       else
         call errmsg(332,dum,dums,dumr,dumd)
       end if
@@ -1183,6 +1240,16 @@ c
             else
                   call errmsg(343,dum,dums,dumr,dumd)
             end if
+      else if (matchs('deterministic',5)) then
+            if (matchs('internal',5)) call splunj
+            if (matchs('forces',5)) call splunj
+            if (matchs('on',2)) then
+                  deterministic_ifv = .true.
+            else if (matchs('off',3)) then
+                  deterministic_ifv = .false.
+            else
+                  call errmsg(343,dum,dums,dumr,dumd)
+            end if
       else
             call errmsg(340,dum,dums,dumr,dumd)
       end if
@@ -1269,6 +1336,7 @@ c
  3500 continue  ! make sure consistent with initst
       line_search    =  .true.
       ls_details     =  .false.
+      ls_cheap_trials = .false.
       ls_min_step_length = 0.01d00
       ls_max_step_length = 1.0d00
       ls_rho         = 0.7d00
@@ -1296,6 +1364,10 @@ c
           ls_details = .true.
           go to 3510
        end if
+       if( matchs('cheap_trials',5) ) then
+          ls_cheap_trials = .true.
+          go to 3510
+       end if
        if( matchs_exact('min_step') ) then
           if( numd(ls_min_step_length) ) go to 3510
           call entits( error_string, ncerror )
@@ -1318,7 +1390,7 @@ c
           go to 10
        end if
        if( matchs('dump',4) ) then
-         write(out,9510) line_search, ls_details,
+         write(out,9510) line_search, ls_details, ls_cheap_trials,
      &          ls_min_step_length, ls_max_step_length, ls_rho,
      &          ls_slack_tol
          go to 3510
@@ -1371,6 +1443,172 @@ c
         num_error = num_error + 1
         go to 10
       end if
+c
+c **********************************************************************
+c *                                                                    *
+c *     storage precision single | double  < stiffness | tangents >    *
+c *                                                                    *
+c *     element [K]s and/or the integration point [D]s are kept in     *
+c *     single precision between uses. computations are unchanged.     *
+c *     default is both when neither is given. may be changed at any   *
+c *     time - blocks convert as they are next used.                   *
+c *                                                                    *
+c **********************************************************************
+c
+ 3700  continue
+c
+      if( matchs_exact('precision') ) call splunj
+      if( matchs_exact('single') ) then
+        local_single = .true.
+      elseif( matchs_exact('double') ) then
+        local_single = .false.
+      else
+        write(out,9580)
+        num_error = num_error + 1
+        go to 10
+      end if
+      if( matchs('stiffness',5) ) then
+        estiff_single_prec = local_single
+      elseif( matchs('tangents',7) ) then
+        cep_single_prec = local_single
+      else
+        estiff_single_prec = local_single
+        cep_single_prec    = local_single
+      end if
+      go to 10
+c
+c **********************************************************************
+c *                                                                    *
+c *     arc length on | off  < target iterations <n> >                 *
+c *                          < radius <value> >                        *
+c *                                                                    *
+c *     cylindrical arc-length control of the load factor in each      *
+c *     static step. the step loading gives the load direction. the    *
+c *     arc length grows/shrinks to reach the target iterations.       *
+c *     radius 0 (default) => set from the first arc-length step       *
+c *                                                                    *
+c **********************************************************************
+c
+ 3800  continue
+c
+      if( matchs('length',4) ) call splunj
+      if( matchs_exact('on') ) then
+        arc_length = .true.
+      elseif( matchs_exact('off') ) then
+        arc_length = .false.
+      else
+        write(out,9540)
+        num_error = num_error + 1
+        go to 10
+      end if
+c
+ 3810 continue
+      if( endcrd(dum) ) go to 10
+      if( matchs('target',4) ) then
+        if( matchs('iterations',4) ) call splunj
+        if( .not. numi( arc_target_iters ) ) then
+          write(out,9590)
+          num_error = num_error + 1
+          arc_target_iters = 4
+        end if
+        if( arc_target_iters .lt. 1 ) arc_target_iters = 4
+        go to 3810
+      end if
+      if( matchs('radius',3) ) then
+        if( .not. numd( arc_radius ) ) then
+          write(out,9600)
+          num_error = num_error + 1
+          arc_radius = zero
+        end if
+        if( arc_radius .lt. zero ) arc_radius = zero
+        go to 3810
+      end if
+      write(out,9610)
+      num_error = num_error + 1
+      go to 10
+c
+c **********************************************************************
+c *                                                                    *
+c *           explicit (central difference) dynamics on | off          *
+c *                                                                    *
+c **********************************************************************
+c
+ 3900 continue
+c
+      if( matchs('dynamics',4) ) call splunj
+      if( matchs_exact('on') ) then
+        explicit_dynamics = .true.
+      elseif( matchs_exact('off') ) then
+        explicit_dynamics = .false.
+      else
+        write(out,9540)
+        num_error = num_error + 1
+        go to 10
+      end if
+c
+ 3910 continue
+      if( endcrd(dum) ) go to 10
+      if( matchs('stable',4) ) call splunj
+      if( matchs('fraction',4) ) then
+        if( .not. numd( explicit_dt_fraction ) ) then
+          write(out,9620)
+          num_error = num_error + 1
+          explicit_dt_fraction = 0.9d00
+        end if
+        if( explicit_dt_fraction .le. zero .or.
+     &      explicit_dt_fraction .gt. 1.0d00 ) then
+          write(out,9620)
+          num_error = num_error + 1
+          explicit_dt_fraction = 0.9d00
+        end if
+        go to 3910
+      end if
+      write(out,9630)
+      num_error = num_error + 1
+      go to 10
+c
+c **********************************************************************
+c *                                                                    *
+c *           anderson acceleration on | off  <depth m>                *
+c *                                                                    *
+c *     mixes each Newton correction with those of the last m (1-10,   *
+c *     default 5) iterations of the step. meant for iterations that   *
+c *     converge linearly: an approximate (e.g. UMAT) tangent or an    *
+c *     inexact iterative solve. with the consistent tangent of the    *
+c *     built-in models Newton already converges quadratically and     *
+c *     acceleration is not expected to reduce the iteration count -   *
+c *     test 90 (mises, consistent tangent) takes 56 iterations with   *
+c *     it vs 50 without.                                              *
+c *                                                                    *
+c **********************************************************************
+c
+ 4000 continue
+c
+      if( matchs('acceleration',5) ) call splunj
+      if( matchs_exact('on') ) then
+        anderson_accel = .true.
+      elseif( matchs_exact('off') ) then
+        anderson_accel = .false.
+      else
+        write(out,9540)
+        num_error = num_error + 1
+        go to 10
+      end if
+c
+ 4010 continue
+      if( endcrd(dum) ) go to 10
+      if( matchs('depth',5) ) then
+        if( .not. numi( anderson_depth ) ) anderson_depth = 0
+        if( anderson_depth .lt. 1 .or. anderson_depth .gt. 10 ) then
+          write(out,9670)
+          num_error = num_error + 1
+          anderson_depth = 5
+        end if
+        go to 4010
+      end if
+      write(out,9680)
+      num_error = num_error + 1
+      go to 10
 c
  9999 sbflg1 = .true.
       sbflg2 = .false.
@@ -1396,6 +1634,7 @@ c
  9510 format(/1x,'.... dump of line search values ....',
      &      /,10x,'line_search:          ', l1,
      &      /,10x,'ls_details:           ', l1,
+     &      /,10x,'ls_cheap_trials:      ', l1,
      &      /,10x,'ls_min_step_length:   ', f10.4,
      &      /,10x,'ls_max_step_length:   ', f10.4,
      &      /,10x,'ls_rho:               ', f10.4,
@@ -1412,6 +1651,19 @@ c
  9560 format(/1x,'>>>>> error: unrecognized initial state command',/)
  9570 format(/1x,'>>>>> error: initial state option allowed only',
      &       /1x,'             before solution of step 1',/)
+ 9580 format(/1x,'>>>>> error: expecting single or double',/)
+ 9590 format(/1x,'>>>>> error: expecting target number of',
+     &       ' iterations',/)
+ 9600 format(/1x,'>>>>> error: expecting arc length radius',/)
+ 9610 format(/1x,'>>>>> error: unrecognized arc length option',/)
+ 9620 format(/1x,'>>>>> error: expecting stable time step fraction',
+     &       ' 0 < f <= 1',/)
+ 9630 format(/1x,'>>>>> error: unrecognized explicit dynamics option',
+     &       /)
+ 9670 format(/1x,'>>>>> error: expecting anderson depth 1 <= m <= 10',
+     &       /)
+ 9680 format(/1x,'>>>>> error: unrecognized anderson acceleration',
+     &       ' option',/)
 c
       contains
 c     ========
@@ -27,7 +27,9 @@ c
      &                      axisymm_ele_types, umat_used,
      &                      implemented_ele_types, bar_types,
      &                      tables, user_lists, nonlocal_analysis,
-     &                      modified_mpcs, umat_serial,
+     &                      modified_mpcs, umat_serial, umat_per_point,
+     &                      deterministic_ifv, estiff_single_prec,
+     &                      cep_single_prec, adapt_target_iters,
      &                      convergence_history, link_types,
      &                      run_user_solution_routine, cp_unloading,
      &                      divergence_check, diverge_check_strict,
@@ -35,7 +37,16 @@ c
      &                      material_model_names, batch_mess_fname,
      &                      creep_model_used, extrapolate,
      &                      extrap_off_next_step, line_search,
-     &                      ls_details, ls_min_step_length,
+     &                      extrap_quadratic, du_prior_valid,
+     &                      arc_length, arc_solve_load,
+     &                      explicit_dynamics, explicit_active,
+     &                      explicit_dt_fraction, explicit_dt_stable,
+     &                      solver_auto,
+     &                      anderson_accel, anderson_depth,
+     &                      ifv_state_valid, solution_was_reset,
+     &                      arc_target_iters, arc_radius, arc_lambda,
+     &                      ls_details, ls_cheap_trials,
+     &                      ls_trial_pass, ls_min_step_length,
      &                      ls_max_step_length, ls_rho, ls_slack_tol,
      &                      initial_stresses_user_routine,
      &                      initial_stresses_file, max_step_limit,
@@ -333,8 +344,26 @@ c
       halt           =  .true.
       extrapolate    =  .true.
       extrap_off_next_step  = .false.
+      extrap_quadratic      = .false.
+      du_prior_valid        = .false.
+      arc_length            = .false.
+      arc_solve_load        = .false.
+      arc_target_iters      = 4
+      arc_radius            = zero
+      arc_lambda            = one
+      explicit_dynamics     = .false.
+      explicit_active       = .false.
+      explicit_dt_fraction  = 0.9d00
+      explicit_dt_stable    = zero
+      solver_auto           = .false.
+      anderson_accel        = .false.
+      anderson_depth        = 5
+      ifv_state_valid       = .false.
+      solution_was_reset    = .false.
       line_search    =  .false.
       ls_details     =  .false.
+      ls_cheap_trials = .false.
+      ls_trial_pass  =  .false.
       ls_min_step_length = 0.01d00
       ls_max_step_length = one
       ls_rho         = 0.7d00
@@ -638,8 +667,25 @@ c
 c                       global flags for UMAT used in model,
 c                       run UMAT element blocks in serial
 c
-      umat_serial = .false.
-      umat_used   = .false.
+      umat_serial    = .false.
+      umat_used      = .false.
+      umat_per_point = .false.
+c
+c                       element scatter (atomics) to assemble
+c                       internal force vector
+c
+      deterministic_ifv = .false.
+c
+c                       double precision storage of element [K]s
+c                       and [D]s
+c
+      estiff_single_prec = .false.
+      cep_single_prec    = .false.
+c
+c                       adaptive solution reacts only to failed
+c                       increments (no predictive step control)
+c
+      adapt_target_iters = 0
 c
 c                       global flags for modeling containing
 c                       a material that creep. will cause
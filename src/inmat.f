@@ -4,7 +4,7 @@ c     *                      subroutine inmat                        *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified : 4/9/2018 rhd               *
+c     *                   last modified : 10/19/2026 agent           *
 C     *                                                              *
 C     *     input of properties of the materials in the material     *
 c     *     library for the current problem.                         *
@@ -16,7 +16,8 @@ c
       subroutine inmat( sbflg1, sbflg2, matnum )
       use global_data ! old common.main
       use main_data, only : matprp, lmtprp, imatprp, dmatprp,
-     &  smatprp, nonlocal_analysis, umat_used, creep_model_used
+     &  smatprp, nonlocal_analysis, umat_used, creep_model_used,
+     &  solution_was_reset
       use erflgs
 c
       implicit none
@@ -44,8 +45,18 @@ c
 c                       if the element properties have already been
 c                       defined, then print a warning that this mat-
 c                       erial will not be used in the current problem.
-c
-      if( elprop ) call errmsg(116,dum,dums,dumr,dumd)
+c                       after a reset solution this is an error: the
+c                       next case still uses the element properties
+c                       (and materials) of the first case.
+c
+      if( elprop ) then
+        if( solution_was_reset ) then
+          write(out,9810)
+          num_error = num_error + 1
+        else
+          call errmsg(116,dum,dums,dumr,dumd)
+        end if
+      end if
 c
 c
 c **********************************************************************
@@ -276,6 +287,12 @@ c                      130-- nstacks (temp, should calculate from element sz)
 c                      131-- nfail ("")
 c                       132-- macro_sz
 c                       133-- cp_sz
+c                      134-- CP crystal clustering misorientation
+c                            tolerance (degrees). 0 => off
+c                      135-- CP cluster check interval (steps).
+c                            0 => never re-split
+c                      136-- CP cluster split tolerance (relative
+c                            difference of slip increments)
 c
 c                      148-- link2 x-stiffness
 c                      149-- link2 y-stiffness
@@ -1486,6 +1503,11 @@ c
       return
  9800 format('>>>> FATAL ERROR: in inmat @',i3,
      &    /, '                  job aborted.'//)
+ 9810 format(/1x,'>>>>> error: materials cannot be defined or ',
+     &  'changed after reset solution.',/14x,'the element ',
+     &  'properties and materials of the first case are kept.',
+     &  /14x,'use a separate input file for other material ',
+     &  'properties.',/)
       end
 c     ****************************************************************
 c     *                                                              *
@@ -1587,6 +1609,7 @@ c
         num_seg_curve_sets = num_seg_curve_sets -1
         return
       end if
+      seg_lookup_built(num_seg_curve_sets) = .false.
 c
       count  = 0
       icn    = 0
@@ -1788,13 +1811,14 @@ c     *                      subroutine inmat_cp                     *
 c     *                                                              *
 c     *                       written by : mcm                       *
 c     *                                                              *
-c     *                   last modified : 3/21/12                    *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     input properties for the crystal plasticity model (#10)  *
 c     *                                                              *
 c     ****************************************************************
 c
       subroutine inmat_cp(matnum)
+      use global_data, only : out, use_mpi
       use main_data, only : matprp, lmtprp, imatprp, dmatprp, smatprp
       implicit integer (a-z)
       integer, intent(in) :: matnum
@@ -1813,6 +1837,9 @@ c           Set defaults
       lmtprp(13,matnum)=.false.
       lmtprp(22,matnum)=.true.
       lmtprp(25,matnum)=.false.
+      dmatprp(134,matnum) = 0.0d00
+      imatprp(135,matnum) = 0
+      dmatprp(136,matnum) = 0.25d00
 c           Read in properties
       reading = .true.
       do while (reading)
@@ -1829,6 +1856,21 @@ c
                   else
                         call errmsg(357,dumi,lab(1:nc),dumr,dumd)
                   end if
+            elseif ( matchs_exact('cluster_misorientation')) then
+                  if (.not. numd(dmatprp(134,matnum))) then
+                        call errmsg(5,dumi,'cluster_misorientation',
+     &                              dumr,dumd)
+                  end if
+            elseif ( matchs_exact('cluster_check_interval')) then
+                  if (.not. numi(imatprp(135,matnum))) then
+                        call errmsg(5,dumi,'cluster_check_interval',
+     &                              dumr,dumd)
+                  end if
+            elseif ( matchs_exact('cluster_split_tolerance')) then
+                  if (.not. numd(dmatprp(136,matnum))) then
+                        call errmsg(5,dumi,'cluster_split_tolerance',
+     &                              dumr,dumd)
+                  end if
             elseif ( matchs_exact('alpha')) then
                   if (.not. numr(matprp(6,matnum))) then
                         call errmsg(5,dumi,'alpha',dumr,dumd)
@@ -1941,8 +1983,20 @@ c
                   cycle
                   end if
             end do
+c
+c           reduced-order crystal groups change on the rank that
+c           owns the element and are not gathered to the root for
+c           restart files. not available with MPI
+c
+      if( use_mpi .and. dmatprp(134,matnum) > 0.0d0 ) then
+            write(out,9000) matnum
+            dmatprp(134,matnum) = 0.0d0
+      end if
 
       return
+ 9000 format(/1x,'>>>>> warning: cluster_misorientation is not',
+     &  ' available with MPI. all crystals are integrated for',
+     &  /,16x,'material: ',i4,/)
       end subroutine
 
 c
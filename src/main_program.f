@@ -4,7 +4,7 @@ c     *                      Main program for WARP3D                 *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified : 4/21/2019 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *                      main program for WARP3D                 *
 c     *                                                              *
@@ -364,6 +364,22 @@ c
          nsn= 31
          go to 25
       end if
+c
+c
+c                       reset solution. back to the unloaded state
+c                       with the model and setup kept (next case).
+c                       otherwise rescan the line (reset load ...
+c                       in solution parameters).
+c
+      if( matchs('reset',5) ) then
+         if( matchs('solution',8) ) then
+            lsn    = nsn
+            hilcmd = .true.
+            nsn    = 36
+            go to 25
+         end if
+         call reset
+      end if
 c
       if(matchs('patch',4)) then
          lsn= nsn
@@ -404,7 +420,7 @@ c
       go to (100,200,300,400,500,600,700,800,900,1000,1100,
      &       1200,1300,1400,1500,1600,1700,1800,1900,2000,
      &       2100,2200,2300,2400,2500,2600,2700,2800,2900,
-     &       3000,3100,3200,3300,3400,3500), nsn
+     &       3000,3100,3200,3300,3400,3500,3600), nsn
 c
 c                       if a high level command is not
 c                       encountered, print an error message
@@ -1032,6 +1048,12 @@ c
  3500 continue
       call patch_data( sbflg1, sbflg2 )
       go to 10
+c
+c                       reset solution to the unloaded state.
+c
+ 3600 continue
+      call incomp_reset_solution
+      go to 10
 
 
 c
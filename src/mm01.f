@@ -115,7 +115,7 @@ c                     allocated because both mxvl and nstr
 c                     are defined as parameters in the include file
 c                     param_def
 c
-      integer :: i
+      integer :: i, nyield
       double precision ::
      &   yfn(mxvl), mrts(mxvl), alpha_n(mxvl,6), devstr_n1(mxvl,nstr),
      &   shear_mod_n1(mxvl), lk(mxvl), kbar(mxvl), eps_vol_n1(mxvl)
@@ -166,10 +166,25 @@ c     &                        kbar, mrts, shear_mod_n1,
 c     &                        hprime_n1, beta, rtse, devstr_n1,
 c     &                        yield )
 c      else
+c
+c                       blocks with a mix of elastic and yielding
+c                       points: gather the yielding points into a
+c                       dense sub-batch, run the return mapping on
+c                       that and scatter back. blocks entirely elastic
+c                       skip the return mapping.
+c
+      nyield = count( yield(1:span) )
+      if( nyield .eq. span ) then
           call mm01_general( span, mxvl, history, history1,
      &                       kbar, mrts, shear_mod_n1,
      &                       hprime_n1, beta, rtse, devstr_n1,
      &                       yield, lk, local_debug, local_out )
+      elseif( nyield .gt. 0 ) then
+          call mm01_general_compact( span, mxvl, nyield, history,
+     &                       history1, kbar, mrts, shear_mod_n1,
+     &                       hprime_n1, beta, rtse, devstr_n1,
+     &                       yield, lk, local_debug, local_out )
+      end if
 c      end if
 c
 c                       update elements that are linear elastic at this
@@ -841,7 +856,7 @@ c
       vbar  = mrts(i) * mrts(i)
       wbar  = history(i,6)**2 + history(i,7)**2 + history(i,8)**2 +
      &        two*( history(i,9)**2 + history(i,10)**2 +
-     &        history(1,11)**2 )
+     &        history(i,11)**2 )
       vwbar = rtse(i,1)*history(i,6) + rtse(i,2)*history(i,7)
      &        + rtse(i,3)*history(i,8) +
      &        two*( rtse(i,4)*history(i,9) + rtse(i,5)*history(i,10) +
@@ -937,6 +952,81 @@ c
 
 c
       end
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm01_general_compact              *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *      gather the yielding points of the block into dense      *
+c     *      arrays, run mm01_general over just those points and     *
+c     *      scatter the updated history and deviators back          *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm01_general_compact( span, mxvl, nyield, history,
+     &                         history1, kbar, mrts, shear_mod_n1,
+     &                         hprime_n1, beta, rtse, devstr_n1,
+     &                         yield, lk, debug, iout )
+      implicit none
+c
+c                     parameters
+c
+      integer :: span, mxvl, nyield, iout
+      logical :: debug, yield(*)
+      double precision ::
+     & history(span,*), history1(span,*), kbar(*),
+     & mrts(*), shear_mod_n1(*), hprime_n1(*), beta(*),
+     & rtse(mxvl,*), devstr_n1(mxvl,*), lk(*)
+c
+c                     locals. history terms 1-11 are all that
+c                     mm01_general reads/writes
+c
+      integer :: i, k, map(mxvl)
+      logical :: yield_c(mxvl)
+      double precision ::
+     & history_c(nyield,11), history1_c(nyield,11), kbar_c(mxvl),
+     & mrts_c(mxvl), shear_mod_c(mxvl), hprime_c(mxvl), beta_c(mxvl),
+     & rtse_c(mxvl,6), devstr_c(mxvl,6), lk_c(mxvl)
+c
+      k = 0
+      do i = 1, span
+        if( .not. yield(i) ) cycle
+        k = k + 1
+        map(k) = i
+      end do
+c
+!DIR$ IVDEP
+      do k = 1, nyield
+        i = map(k)
+        history_c(k,1:11) = history(i,1:11)
+        kbar_c(k)      = kbar(i)
+        mrts_c(k)      = mrts(i)
+        shear_mod_c(k) = shear_mod_n1(i)
+        hprime_c(k)    = hprime_n1(i)
+        beta_c(k)      = beta(i)
+        lk_c(k)        = lk(i)
+        rtse_c(k,1:6)  = rtse(i,1:6)
+        yield_c(k)     = .true.
+      end do
+c
+      call mm01_general( nyield, mxvl, history_c, history1_c,
+     &                   kbar_c, mrts_c, shear_mod_c,
+     &                   hprime_c, beta_c, rtse_c, devstr_c,
+     &                   yield_c, lk_c, debug, iout )
+c
+!DIR$ IVDEP
+      do k = 1, nyield
+        i = map(k)
+        history1(i,1:3)  = history1_c(k,1:3)
+        history1(i,5:11) = history1_c(k,5:11)
+        devstr_n1(i,1:6) = devstr_c(k,1:6)
+      end do
+c
+      return
+      end
 
 c     ****************************************************************
 c     *                                                              *
@@ -1284,6 +1374,8 @@ c
        cep(i,2,3) = c4(i)
        cep(i,3,2) = c4(i)
       end do
+c
+      if( .not. any( yield(1:span) ) ) return
 c
       do i = 1, span
        if( .not. yield(i) ) cycle
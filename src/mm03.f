@@ -361,6 +361,1366 @@ c
 c
       end subroutine mm03p_a
       end subroutine mm03p
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03e -- vectorized elastic/unloading pass for block of  *
+c *                      mises or gurson elements                        *
+c *                      updated: 10/19/2026 agent                       *
+c *                                                                      *
+c ************************************************************************
+c
+c
+      subroutine mm03e(
+     &  span, gpn, felem, hist_size, signal, iout, null_point,
+     &  nonlinear_flag, sigma_o, deps, stress_n, stress_n1, history,
+     &  history1, yld_func, plastic_list, num_plastic )
+c
+      implicit none
+      include 'param_def'
+c
+c               parameter declarations
+c
+      integer :: span, gpn, felem, hist_size, iout,
+     &           plastic_list(*), num_plastic
+      logical :: signal, null_point(*), nonlinear_flag(*)
+      double precision ::
+     &  sigma_o(*), deps(mxvl,6), stress_n(nstrs,*),
+     &  stress_n1(nstrs,*), history(span,hist_size,*),
+     &  history1(span,hist_size,*), yld_func(*)
+c
+c               locals
+c
+      integer :: i, state, iword(2)
+      double precision :: dword, dsenrg
+      logical :: plastic_loading(mxvl), unload_from_plastic(mxvl)
+      equivalence ( dword, iword )
+      double precision, parameter :: zero = 0.0d0, half = 0.5d0
+c
+c              mm03 settles loading vs. unloading for a point from
+c              the trial yield function (mm03p) and the state flag
+c              saved in history word 6. points that remain elastic or
+c              unload elastically need only the strain energy and
+c              the history copy - do them here for the whole span.
+c              the points that load plastically are returned in a
+c              compact list for the return mapping (mm03v, mm03gv,
+c              mm03). arithmetic matches the mm03 elastic branch
+c              exactly.
+c
+!DIR$ VECTOR ALIGNED
+      do i = 1, span
+        dword = history(i,6,gpn)
+        state = iword(1)
+        if( state .eq. -1 ) then
+          plastic_loading(i) = yld_func(i) .gt. zero
+        else
+          plastic_loading(i) = yld_func(i) .ge. zero
+        end if
+        unload_from_plastic(i) = state .eq. 1
+        if( null_point(i) .or. .not. nonlinear_flag(i) )
+     &      plastic_loading(i) = .true.   ! not handled here
+      end do
+c
+!DIR$ IVDEP
+      do i = 1, span
+        if( plastic_loading(i) ) cycle
+        dsenrg = deps(i,1) * ( stress_n(1,i)+stress_n1(1,i) )  +
+     &           deps(i,2) * ( stress_n(2,i)+stress_n1(2,i) )  +
+     &           deps(i,3) * ( stress_n(3,i)+stress_n1(3,i) )  +
+     &           deps(i,4) * ( stress_n(4,i)+stress_n1(4,i) )  +
+     &           deps(i,5) * ( stress_n(5,i)+stress_n1(5,i) )  +
+     &           deps(i,6) * ( stress_n(6,i)+stress_n1(6,i) )
+        stress_n1(7,i) = stress_n(7,i) + dsenrg * half
+        stress_n1(8,i) = stress_n(8,i)
+        stress_n1(9,i) = stress_n(9,i)
+        history1(i,7,gpn)  = zero
+        history1(i,8,gpn)  = zero
+        history1(i,9,gpn)  = zero
+        history1(i,10,gpn) = history(i,10,gpn) + deps(i,1)
+        history1(i,11,gpn) = history(i,11,gpn) + deps(i,2)
+        history1(i,12,gpn) = history(i,12,gpn) + deps(i,3)
+        history1(i,13,gpn) = history(i,13,gpn) + deps(i,4)
+        history1(i,14,gpn) = history(i,14,gpn) + deps(i,5)
+        history1(i,15,gpn) = history(i,15,gpn) + deps(i,6)
+      end do
+c
+c              state flag -> elastic (-1). other half of the word
+c              is kept as in mm03. build list of plastic points.
+c
+      num_plastic = 0
+      do i = 1, span
+        if( plastic_loading(i) ) then
+          if( null_point(i) .or. .not. nonlinear_flag(i) ) cycle
+          num_plastic = num_plastic + 1
+          plastic_list(num_plastic) = i
+          cycle
+        end if
+        dword    = history(i,6,gpn)
+        iword(1) = -1
+        history1(i,6,gpn) = dword
+        if( signal .and. unload_from_plastic(i) .and.
+     &      abs(yld_func(i)) .gt. 0.01 * sigma_o(i) )
+     &    write(iout,9000) felem+i-1, gpn, yld_func(i)
+      end do
+c
+      return
+c
+ 9000 format(10x,i5,i3,' elastic unloading f = ',f12.3 )
+c
+      end subroutine mm03e
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03v -- vectorized return mapping for the mises points  *
+c *                      of a block that load plastically                *
+c *                      updated: 10/19/2026 agent                       *
+c *                                                                      *
+c ************************************************************************
+c
+c
+      subroutine mm03v(
+     &  span, gpn, felem, hist_size, signal, allow_cut, iout, dtime,
+     &  e, nu, sigma_o, f0, nucleation, eps_ref, m_power, n_power,
+     &  h_fixed, deps, stress_n, stress_n1, history, history1,
+     &  yld_func, q_trial, plastic_list, num_plastic, cut_step )
+c
+      implicit none
+      include 'param_def'
+c
+c               parameter declarations
+c
+      integer :: span, gpn, felem, hist_size, iout,
+     &           plastic_list(*), num_plastic
+      logical :: signal, allow_cut, nucleation(*), cut_step
+      double precision ::
+     &  dtime, e(*), nu(*), sigma_o(*), f0(*), eps_ref(*), m_power(*),
+     &  n_power(*), h_fixed(*), deps(mxvl,6), stress_n(nstrs,*),
+     &  stress_n1(nstrs,*), history(span,hist_size,*),
+     &  history1(span,hist_size,*), yld_func(*), q_trial(*)
+c
+c               locals
+c
+      integer :: i, k, nv, nscalar, loop, state, iword(2),
+     &           idx(mxvl), iconverge(mxvl), vm_converge(mxvl),
+     &           msg(mxvl)
+      logical :: consth(mxvl), rate_depen(mxvl), active(mxvl),
+     &           eval(mxvl), pl_eval(mxvl)
+      double precision :: dword, sridder, deplas_new, term0, term1,
+     &  term2, ebarp_new, p_new, scale, sm, dsenrg, dsig(6),
+     &  deps_plas(6),
+     &  ebarp(mxvl), sbar(mxvl), qt(mxvl), shear_mod(mxvl),
+     &  threeg(mxvl), eps_o(mxvl), eps_compare(mxvl), sig_y(mxvl),
+     &  h_constant(mxvl), mpoweri(mxvl), inviscid_stress(mxvl),
+     &  h_inviscid(mxvl), deplas_low(mxvl), deplas_high(mxvl),
+     &  deplas_mid(mxvl), deplas_riddr(mxvl), resid_low(mxvl),
+     &  resid_high(mxvl), resid_mid(mxvl), resid_new(mxvl),
+     &  newyld_high(mxvl), newyld_mid(mxvl), newyld(mxvl),
+     &  deplas(mxvl), h_new(mxvl), e_pt(mxvl), n_pow(mxvl),
+     &  eb_try(mxvl)
+      equivalence ( dword, iword )
+c
+c               constants carry the same (single precision) values
+c               as those in mm03 and mm03q so the update reproduces
+c               the scalar one bit for bit.
+c
+      double precision, parameter :: zero = 0.0d0, half = 0.5d0,
+     &   one = 1.0d0, three = 3.0d0, third = 0.3333333333,
+     &   toler = 0.000001, sig_tol = 0.000001, unused = -1.11e30
+c
+c              mm03q solves  q_trial - 3g*deplas - yield(deplas) = 0
+c              for each point with Ridder's method. here all mises
+c              points in the plastic list advance through the same
+c              Ridder iteration together. a point drops out of the
+c              active mask when mm03q would leave its loop. the
+c              uniaxial curve is linear or the power-law form
+c              (mm03is_v) - segmental curves stay with mm03. the
+c              gurson points are returned in plastic_list for mm03gv.
+c
+      nv      = 0
+      nscalar = 0
+      do k = 1, num_plastic
+        i = plastic_list(k)
+        if( f0(i) .gt. zero .or. nucleation(i) ) then
+          nscalar = nscalar + 1
+          plastic_list(nscalar) = i
+        else
+          nv = nv + 1
+          idx(nv) = i
+        end if
+      end do
+      num_plastic = nscalar
+      if( nv .eq. 0 ) return
+c
+c              1. start values and brackets on deplas. then evaluate
+c                 the residual at the upper bound.
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        i = idx(k)
+        ebarp(k)          = history(i,1,gpn)
+        sbar(k)           = history(i,2,gpn)
+        qt(k)             = q_trial(i)
+        sig_y(k)          = sigma_o(i)
+        e_pt(k)           = e(i)
+        n_pow(k)          = n_power(i)
+        h_constant(k)     = h_fixed(i)
+        shear_mod(k)      = half * e(i) / ( one + nu(i) )
+        threeg(k)         = three * shear_mod(k)
+        eps_o(k)          = sigma_o(i) / e(i)
+        consth(k)         = n_power(i) .eq. zero
+        rate_depen(k)     = dtime .gt. zero .and. m_power(i) .gt. zero
+        mpoweri(k)        = one
+        if( rate_depen(k) ) mpoweri(k) = one / m_power(i)
+        eps_compare(k)    = toler * max( ebarp(k), eps_o(k) )
+        deplas_low(k)     = zero
+        resid_low(k)      = qt(k) - sbar(k)
+        deplas_high(k)    = ( qt(k) - sig_y(k) ) / threeg(k)
+        deplas_riddr(k)   = unused
+        iconverge(k)      = 0
+        vm_converge(k)    = 0
+        msg(k)            = 0
+        eval(k)           = .true.
+      end do
+c
+      call mm03v_resid( deplas_high, newyld_high, resid_high )
+c
+      do k = 1, nv
+        active(k) = .false.
+        if( (resid_low(k) .gt. zero .and. resid_high(k) .lt. zero) .or.
+     &      (resid_low(k) .lt. zero .and. resid_high(k) .gt. zero) )
+     &    then
+          active(k)    = .true.
+        elseif( abs(resid_low(k)) .le. sig_tol*sbar(k) ) then
+          newyld(k)    = sbar(k)
+          deplas(k)    = zero
+          iconverge(k) = 1
+        elseif( abs(resid_high(k)) .le. sig_tol*sbar(k) ) then
+          deplas(k)    = deplas_high(k)
+          newyld(k)    = newyld_high(k)
+          iconverge(k) = 2
+        else
+          msg(k)         = 1
+          vm_converge(k) = 1
+        end if
+      end do
+c
+c              2. Ridder iterations in lockstep. mid-point residual,
+c                 Ridder estimate and its residual, then the new
+c                 brackets - as in mm03q steps 2a-2e.
+c
+      do loop = 1, 20
+c
+      if( .not. any( active(1:nv) ) ) exit
+      eval(1:nv) = active(1:nv)
+      deplas_mid(1:nv) = half * ( deplas_low(1:nv) + deplas_high(1:nv) )
+      call mm03v_resid( deplas_mid, newyld_mid, resid_mid )
+c
+      do k = 1, nv
+        if( .not. active(k) ) cycle
+        sridder = sqrt( resid_mid(k)**2 - resid_low(k)*resid_high(k) )
+        if( sridder .eq. zero ) then
+          msg(k)         = 2
+          vm_converge(k) = 1
+          active(k)      = .false.
+          cycle
+        end if
+        deplas_new = deplas_mid(k) + (deplas_mid(k)-deplas_low(k)) *
+     &               (sign(one,resid_low(k)-resid_high(k)) *
+     &                resid_mid(k)/sridder)
+        if( abs(deplas_new-deplas_riddr(k)) .le. eps_compare(k) ) then
+          iconverge(k) = 3
+          deplas(k)    = deplas_new
+          active(k)    = .false.
+          cycle
+        end if
+        deplas_riddr(k) = deplas_new
+      end do
+c
+      eval(1:nv) = active(1:nv)
+      call mm03v_resid( deplas_riddr, newyld, resid_new )
+c
+      do k = 1, nv
+        if( .not. active(k) ) cycle
+        if( abs(resid_new(k)) .le. sig_tol*newyld(k) ) then
+          iconverge(k) = 4
+          deplas(k)    = deplas_riddr(k)
+          active(k)    = .false.
+          cycle
+        end if
+        if( sign(resid_mid(k),resid_new(k)) .ne. resid_mid(k) ) then
+          deplas_low(k)  = deplas_mid(k)
+          resid_low(k)   = resid_mid(k)
+          deplas_high(k) = deplas_riddr(k)
+          resid_high(k)  = resid_new(k)
+        elseif( sign(resid_low(k),resid_new(k)) .ne. resid_low(k) ) then
+          deplas_high(k) = deplas_riddr(k)
+          resid_high(k)  = resid_new(k)
+        elseif( sign(resid_high(k),resid_new(k)) .ne. resid_high(k) )
+     &    then
+          deplas_low(k)  = deplas_riddr(k)
+          resid_low(k)   = resid_new(k)
+        else
+          msg(k)         = 3
+          vm_converge(k) = 1
+          active(k)      = .false.
+          cycle
+        end if
+        if( abs(deplas_high(k)-deplas_low(k)) .le. eps_compare(k) ) then
+          iconverge(k) = 5
+          deplas(k)    = ( deplas_high(k) + deplas_low(k) ) * half
+          active(k)    = .false.
+        end if
+      end do
+c
+      end do
+c
+      do k = 1, nv
+        if( active(k) ) vm_converge(k) = 2
+      end do
+c
+c              3. converged points. final stress and plastic modulus
+c                 where the last residual was not at deplas, then the
+c                 rate dependent modulus (mm03q step 3).
+c
+      do k = 1, nv
+        eval(k) = iconverge(k) .eq. 3 .or. iconverge(k) .eq. 5
+      end do
+      call mm03v_resid( deplas, newyld, resid_new )
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( iconverge(k) .eq. 0 ) cycle
+        i = idx(k)
+        if( deplas(k) .le. zero ) then
+          if( abs(deplas(k)) .gt. 0.001*eps_o(k) ) vm_converge(k) = 3
+        end if
+        h_new(k) = h_inviscid(k)
+        if( rate_depen(k) ) then
+          term0 = ( newyld(k) / inviscid_stress(k) ) **
+     &            ( one - m_power(i) )
+          term1 = term0 * eps_ref(i)*inviscid_stress(k) / m_power(i) /
+     &            dtime
+          term2 = h_inviscid(k) * newyld(k) / inviscid_stress(k)
+          h_new(k) = term1 + term2
+        end if
+      end do
+c
+c              4. radial return of the trial stresses, energies and
+c                 history for the converged points (mm03q step 3 and
+c                 the plastic branch of mm03).
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( iconverge(k) .eq. 0 ) cycle
+        i = idx(k)
+        ebarp_new = ebarp(k) + deplas(k)
+        p_new     = - ( stress_n1(1,i) + stress_n1(2,i) +
+     &                  stress_n1(3,i) ) * third
+        scale     = threeg(k) * deplas(k) / qt(k)
+        sm        = - p_new
+        stress_n1(1,i) = stress_n1(1,i) - scale*( stress_n1(1,i) - sm )
+        stress_n1(2,i) = stress_n1(2,i) - scale*( stress_n1(2,i) - sm )
+        stress_n1(3,i) = stress_n1(3,i) - scale*( stress_n1(3,i) - sm )
+        stress_n1(4,i) = stress_n1(4,i) - scale * stress_n1(4,i)
+        stress_n1(5,i) = stress_n1(5,i) - scale * stress_n1(5,i)
+        stress_n1(6,i) = stress_n1(6,i) - scale * stress_n1(6,i)
+        dsenrg = deps(i,1) * ( stress_n(1,i)+stress_n1(1,i) )  +
+     &           deps(i,2) * ( stress_n(2,i)+stress_n1(2,i) )  +
+     &           deps(i,3) * ( stress_n(3,i)+stress_n1(3,i) )  +
+     &           deps(i,4) * ( stress_n(4,i)+stress_n1(4,i) )  +
+     &           deps(i,5) * ( stress_n(5,i)+stress_n1(5,i) )  +
+     &           deps(i,6) * ( stress_n(6,i)+stress_n1(6,i) )
+        stress_n1(7,i) = stress_n(7,i) + dsenrg * half
+        history1(i,1,gpn) = ebarp_new
+        history1(i,2,gpn) = newyld(k)
+        history1(i,3,gpn) = p_new
+        history1(i,4,gpn) = h_new(k)
+        history1(i,5,gpn) = zero
+        history1(i,7,gpn) = zero
+        history1(i,8,gpn) = deplas(k)
+        history1(i,9,gpn) = newyld(k)
+        dsig(1) = stress_n1(1,i) - stress_n(1,i)
+        dsig(2) = stress_n1(2,i) - stress_n(2,i)
+        dsig(3) = stress_n1(3,i) - stress_n(3,i)
+        dsig(4) = stress_n1(4,i) - stress_n(4,i)
+        dsig(5) = stress_n1(5,i) - stress_n(5,i)
+        dsig(6) = stress_n1(6,i) - stress_n(6,i)
+        deps_plas(1) = deps(i,1) - (dsig(1) - nu(i)*(dsig(2)+dsig(3)))
+     &                 / e(i)
+        deps_plas(2) = deps(i,2) - (dsig(2) - nu(i)*(dsig(1)+dsig(3)))
+     &                 / e(i)
+        deps_plas(3) = deps(i,3) - (dsig(3) - nu(i)*(dsig(1)+dsig(2)))
+     &                 / e(i)
+        deps_plas(4) = deps(i,4) - dsig(4) / shear_mod(k)
+        deps_plas(5) = deps(i,5) - dsig(5) / shear_mod(k)
+        deps_plas(6) = deps(i,6) - dsig(6) / shear_mod(k)
+        history1(i,10,gpn) = history(i,10,gpn) + deps(i,1) -
+     &                       deps_plas(1)
+        history1(i,11,gpn) = history(i,11,gpn) + deps(i,2) -
+     &                       deps_plas(2)
+        history1(i,12,gpn) = history(i,12,gpn) + deps(i,3) -
+     &                       deps_plas(3)
+        history1(i,13,gpn) = history(i,13,gpn) + deps(i,4) -
+     &                       deps_plas(4)
+        history1(i,14,gpn) = history(i,14,gpn) + deps(i,5) -
+     &                       deps_plas(5)
+        history1(i,15,gpn) = history(i,15,gpn) + deps(i,6) -
+     &                       deps_plas(6)
+        stress_n1(8,i) = stress_n(8,i) + half * (newyld(k) + sbar(k)) *
+     &                   ( ebarp_new - ebarp(k) )
+        stress_n1(9,i) = stress_n(9,i) + ( ebarp_new - ebarp(k) )
+      end do
+c
+c              5. state flag -> plastic (1) and the messages mm03
+c                 writes, in the order of the plastic list.
+c
+      do k = 1, nv
+        i = idx(k)
+        dword = history(i,6,gpn)
+        state = iword(1)
+        if( state .ne. 1 .and. signal )
+     &    write(iout,9017) felem+i-1, gpn, yld_func(i)
+        if( msg(k) .eq. 1 ) write(iout,9300)
+        if( msg(k) .eq. 2 ) write(iout,9310)
+        if( msg(k) .eq. 3 ) write(iout,9420)
+        if( vm_converge(k) .eq. 1 .or. vm_converge(k) .eq. 2 ) then
+          if( allow_cut ) then
+            cut_step = .true.
+            write(iout,9052) felem+i-1, gpn, vm_converge(k)
+            cycle
+          else
+            write(iout,9062) felem+i-1, gpn
+            call abort_job
+          end if
+        end if
+        if( vm_converge(k) .eq. 3 ) write(iout,9064) felem+i-1, gpn
+        iword(1) = 1
+        history1(i,6,gpn) = dword
+      end do
+c
+      return
+c
+ 9017 format(10x,i5,i3,' point yields.  f    = ',f12.3 )
+ 9052 format(
+     &/,3x,'>> Warning: iterations for mises model failed.',
+     &/,3x,'            material model requesting step size reduction.',
+     &/,3x,'            element, gauss point, gt-flag: ',i8,i3,i3 )
+ 9062 format(
+     &/,3x,'>> FATAL ERROR: iterations for mises model failed.',
+     &/,3x,'                did not converge.',
+     &/,3x,'                load step reduction not enabled.,'
+     &/,3x,'                analysis terminated.',
+     &/,3x,'                element, gauss point, gt-flag: ',i8,i3,i3 )
+ 9064 format(
+     &/,3x,'>> WARNING: during mises update, the increment of',
+     &/,3x,'                plastic strain is negative.',
+     &/,3x,'                element, gauss point ',i8,i3 )
+ 9300 format(/,3x,'>> Error: deplas not properly bracketed in',
+     &  /,7x,'mises stress update.')
+ 9310 format(/,3x,'>> Error: divide by zero in mises update')
+ 9420 format(/,3x,'>> Error: failed to make new bracket',
+     &       /,3x,'          for mises update of deplas')
+c
+      contains
+c     ========
+c
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03v_resid -- mises residual for the masked points      *
+c *                            (mm03qq over the span)                    *
+c *                                                                      *
+c ************************************************************************
+c
+      subroutine mm03v_resid( dplas, sig_bar, resid_now )
+      implicit none
+c
+      double precision :: dplas(*), sig_bar(*), resid_now(*)
+c
+      integer :: k
+      double precision :: factor
+c
+c              power-law curve: the newton loop on strain of mm03is
+c              for all points together.
+c
+      do k = 1, nv
+        pl_eval(k) = eval(k) .and. .not. consth(k)
+        eb_try(k)  = ebarp(k) + dplas(k)
+      end do
+      if( any( pl_eval(1:nv) ) )
+     &  call mm03is_v( nv, pl_eval, eb_try, sig_y, e_pt, n_pow,
+     &                 inviscid_stress, h_inviscid )
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( .not. eval(k) ) cycle
+        if( consth(k) ) then
+          inviscid_stress(k) = sig_y(k) + h_constant(k) *
+     &                         (ebarp(k)+dplas(k))
+          h_inviscid(k)      = h_constant(k)
+        end if
+        if( rate_depen(k) ) then
+          factor       = eps_ref(idx(k)) * dplas(k)/dtime + one
+          sig_bar(k)   = inviscid_stress(k) * factor**mpoweri(k)
+          resid_now(k) = qt(k) - threeg(k) * dplas(k) - sig_bar(k)
+        else
+          sig_bar(k)   = inviscid_stress(k)
+          resid_now(k) = qt(k) - threeg(k) * dplas(k) - sig_bar(k)
+        end if
+      end do
+c
+      return
+      end subroutine mm03v_resid
+      end subroutine mm03v
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03gv -- vectorized return mapping for the gurson       *
+c *                       points of a block that load plastically        *
+c *                       updated: 10/19/2026 agent                      *
+c *                                                                      *
+c ************************************************************************
+c
+c
+      subroutine mm03gv(
+     &  span, gpn, felem, hist_size, signal, allow_cut, iout, dtime,
+     &  e, nu, sigma_o, eps_ref, m_power, n_power, h_fixed, q1, q2, q3,
+     &  nucleation, nuc_s_n, nuc_e_n, nuc_f_n, deps, stress_n,
+     &  stress_n1, stress_n1_elas, history, history1, yld_func,
+     &  plastic_list, num_plastic, cut_step )
+c
+      implicit none
+      include 'param_def'
+c
+c               parameter declarations
+c
+      integer :: span, gpn, felem, hist_size, iout,
+     &           plastic_list(*), num_plastic
+      logical :: signal, allow_cut, nucleation(*), cut_step
+      double precision ::
+     &  dtime, e(*), nu(*), sigma_o(*), eps_ref(*), m_power(*),
+     &  n_power(*), h_fixed(*), q1(*), q2(*), q3(*), nuc_s_n(*),
+     &  nuc_e_n(*), nuc_f_n(*), deps(mxvl,6), stress_n(nstrs,*),
+     &  stress_n1(nstrs,*), stress_n1_elas(mxvl,6,*),
+     &  history(span,hist_size,*), history1(span,hist_size,*),
+     &  yld_func(*)
+c
+c               locals
+c
+      integer, parameter :: max_sub = 12
+      integer :: i, j, k, nv, isub, nsub_max, loop, loop_bound, state,
+     &           iword(2), idx(mxvl), nsubin(mxvl), status(mxvl),
+     &           ss_msg(mxvl), nchk(mxvl)
+      logical :: consth(mxvl), rate_depen(mxvl), big_eps(mxvl),
+     &           sub_active(mxvl), newton(mxvl), conv(mxvl),
+     &           eval(mxvl), pl_eval(mxvl), us_active(mxvl),
+     &           ss_mask(mxvl), bound(mxvl), bracketed(mxvl),
+     &           ss_iter(mxvl), ss_done0(mxvl), ss_done(mxvl),
+     &           converge
+      double precision :: dword, equiv_eps, scale, d_ebarp, term1,
+     &  term2, term3, term4, term5, r, dr_ebarp, eps_correction, temp,
+     &  phi, gp, gq, gsbar, gf, d11, d12, d21, d22, r1, r2, del_dep,
+     &  del_deq, eps_compare, a1, a2, b1, b2, b3, b4, b5, df_dep,
+     &  debarp_dep, df_deq, debarp_deq, beta, alpha, ch, sh, smel,
+     &  chk1, dsenrg, a, b, c, d, std(6), dsig(6), deps_plas(6),
+     &  factor1, factor2, deps_plas_bar, newsig(6)
+      double precision :: ebarp(mxvl), sbar(mxvl), f(mxvl),
+     &  senerg(mxvl), eps_o(mxvl), shear_mod(mxvl), bulk_mod(mxvl),
+     &  mpoweri(mxvl), sig_y(mxvl), h_constant(mxvl), e_pt(mxvl),
+     &  n_pow(mxvl), eps_ratio(mxvl), dtauel(mxvl,6),
+     &  deps_sub(mxvl,6), stress_start(mxvl,6), total_dep(mxvl),
+     &  total_deq(mxvl), p_trial(mxvl), q_trial(mxvl), dep(mxvl),
+     &  deq(mxvl), dep_old(mxvl), deq_old(mxvl), dep_last_sub(mxvl),
+     &  deq_last_sub(mxvl), p_new(mxvl), q_new(mxvl), ebarp_new(mxvl),
+     &  sbar_new(mxvl), f_new(mxvl), h_new(mxvl), a_nuc(mxvl),
+     &  a_prime(mxvl), sb_inv(mxvl), h_inv(mxvl), t_numer(mxvl),
+     &  strain_toler(mxvl), t1(mxvl), t2(mxvl), t3(mxvl),
+     &  ebarp_big(mxvl), r_low(mxvl), r_high(mxvl), ebarp_low(mxvl),
+     &  ebarp_high(mxvl), ebarp_old(mxvl), deps_old(mxvl),
+     &  deps_nb(mxvl), r_nb(mxvl), dr_nb(mxvl), chk_val(mxvl,max_sub)
+      double precision, external :: mm03f
+      equivalence ( dword, iword )
+c
+c               constants carry the same (single precision) values
+c               as those in mm03, mm03s, mm03us, mm03ss, mm03dr and
+c               mm03ap so the update reproduces the scalar one bit
+c               for bit.
+c
+      double precision, parameter :: zero = 0.0d0, half = 0.5d0,
+     &   one = 1.0d0, two = 2.0d0, three = 3.0d0, four = 4.0d0,
+     &   six = 6.0d0, onehalf = 1.5d0, third = 0.3333333333,
+     &   root23 = 0.4714, ptone = 0.1, root22 = 0.70710678,
+     &   root2 = 1.41421356, eps_tol = 100.0, toler = 0.00001,
+     &   tol_yf = 0.001, tol_us = 0.000001, tol_ss = 0.00001,
+     &   root_2_pi = 2.50663d0
+      double precision, parameter :: sfactors(5) =
+     &   (/ 1.5d0, 2.0d0, 2.0d0, 4.0d0, 4.0d0 /)
+c
+c              mm03 integrates a gurson point over nsubin
+c              subincrements. each one is a newton iteration on
+c              (dep, deq) - mm03s - that needs ebarp, sbar, f at
+c              every iterate from a scalar newton loop - mm03us, or
+c              the bracketed newton-bisection of mm03ss when mm03us
+c              fails. here all gurson points in the plastic list run
+c              these loops together under masks: subincrement isub for
+c              the points with nsubin >= isub, newton iterations for
+c              the points not yet converged, the mm03us/mm03ss
+c              iterations for the points that need them. the start
+c              values of a subincrement (isubincr semantics) and the
+c              exits of each loop are those of the scalar routines.
+c              segmental curves stay with mm03 (not called for
+c              segmental blocks). messages are written at the end in
+c              the order of the plastic list.
+c
+      nv = num_plastic
+      if( nv .eq. 0 ) return
+      num_plastic = 0
+      nsub_max = 0
+c
+c              1. start of step values, strain increment check and
+c                 the number of subincrements (mm03).
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        i = plastic_list(k)
+        idx(k)          = i
+        sig_y(k)        = sigma_o(i)
+        e_pt(k)         = e(i)
+        n_pow(k)        = n_power(i)
+        consth(k)       = n_power(i) .eq. zero
+        eps_o(k)        = sigma_o(i) / e(i)
+        shear_mod(k)    = half * e(i) /(one+nu(i))
+        bulk_mod(k)     = e(i) * third / ( one - two*nu(i) )
+        rate_depen(k)   = dtime .gt. zero .and. m_power(i) .gt. zero
+        mpoweri(k)      = one
+        if( rate_depen(k) ) mpoweri(k) = one / m_power(i)
+        h_constant(k)   = h_fixed(i)
+        ebarp(k)        = history(i,1,gpn)
+        sbar(k)         = history(i,2,gpn)
+        f(k)            = history(i,5,gpn)
+        senerg(k)       = stress_n(7,i)
+        status(k)       = 0
+        ss_msg(k)       = 0
+        nchk(k)         = 0
+        newton(k)       = .false.
+        equiv_eps = (deps(i,1)-deps(i,2))**2 +
+     &              (deps(i,2)-deps(i,3))**2 +
+     &              (deps(i,1)-deps(i,3))**2 +
+     &              half * ( deps(i,4)**2 +
+     &              deps(i,5)**2 + deps(i,6)**2 )
+        equiv_eps = root23 * sqrt ( equiv_eps )
+        eps_ratio(k) = equiv_eps/eps_o(k)
+        big_eps(k)   = equiv_eps .gt. eps_tol * eps_o(k)
+        if( big_eps(k) ) status(k) = 1
+        if( ebarp(k) .gt. zero ) then
+          nsubin(k) = max( idint(one+ptone*equiv_eps/eps_o(k)), 1 )
+        else
+          nsubin(k) = 1
+        end if
+        if( rate_depen(k) ) nsubin(k) = 1
+        scale = one / dble(nsubin(k))
+        total_dep(k) = zero
+        total_deq(k) = zero
+        do j = 1, 6
+          dtauel(k,j)       = ( stress_n1_elas(i,j,gpn) -
+     &                          stress_n(j,i) ) * scale
+          deps_sub(k,j)     = deps(i,j) * scale
+          stress_start(k,j) = stress_n(j,i)
+        end do
+      end do
+c
+      do k = 1, nv
+        if( status(k) .eq. 0 ) nsub_max = max( nsub_max, nsubin(k) )
+      end do
+c
+c              2. subincrements in lockstep
+c
+      do isub = 1, nsub_max
+c
+      do k = 1, nv
+        sub_active(k) = status(k) .eq. 0 .and. isub .le. nsubin(k)
+      end do
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( .not. sub_active(k) ) cycle
+        i = idx(k)
+        stress_n1(1,i) = stress_start(k,1) + dtauel(k,1)
+        stress_n1(2,i) = stress_start(k,2) + dtauel(k,2)
+        stress_n1(3,i) = stress_start(k,3) + dtauel(k,3)
+        stress_n1(4,i) = stress_start(k,4) + dtauel(k,4)
+        stress_n1(5,i) = stress_start(k,5) + dtauel(k,5)
+        stress_n1(6,i) = stress_start(k,6) + dtauel(k,6)
+        p_trial(k) = - ( stress_n1(1,i) + stress_n1(2,i) +
+     &                   stress_n1(3,i) ) * third
+        a          = stress_n1(1,i) - stress_n1(3,i)
+        b          = stress_n1(1,i) - stress_n1(2,i)
+        c          = stress_n1(2,i) - stress_n1(3,i)
+        d          = stress_n1(4,i)*stress_n1(4,i) +
+     &               stress_n1(5,i)*stress_n1(5,i) +
+     &               stress_n1(6,i)*stress_n1(6,i)
+        q_trial(k) = root22 * sqrt( a*a + b*b + c*c + six*d )
+c
+c              mm03s step A: start values for dep, deq
+c
+        if( isub .gt. 1 ) then
+          dep(k) = dep_last_sub(k)
+          deq(k) = deq_last_sub(k)
+        else
+          dep(k) = zero
+          deq(k) = zero
+        end if
+        dep_old(k) = dep(k)
+        deq_old(k) = deq(k)
+        newton(k)  = .true.
+      end do
+c
+c              3. newton iterations on dep, deq (mm03s steps B-F)
+c
+      do loop = 1, 30
+c
+      if( .not. any( newton(1:nv) .and. sub_active(1:nv) ) ) exit
+      do k = 1, nv
+        newton(k) = newton(k) .and. sub_active(k)
+        if( .not. newton(k) ) cycle
+        p_new(k) = p_trial(k) + bulk_mod(k) * dep(k)
+        q_new(k) = q_trial(k) - three * shear_mod(k) * deq(k)
+      end do
+c
+c              C. ebarp_new, sbar_new, f_new, h_new: fast mm03us,
+c                 then mm03ss for the points where it fails. a point
+c                 failing both ends its update (gt_converge = 1).
+c
+      call mm03gv_us
+      do k = 1, nv
+        ss_mask(k) = newton(k) .and. .not. conv(k)
+      end do
+      if( any( ss_mask(1:nv) ) ) call mm03gv_ss
+      do k = 1, nv
+        if( newton(k) .and. .not. conv(k) ) then
+          status(k) = 3
+          newton(k) = .false.
+        end if
+      end do
+c
+c              D. yield function, derivatives and the jacobian of
+c                 the 2 residuals (mm03dr), then steps E-F.
+c
+      eval(1:nv) = newton(1:nv)
+      call mm03gv_ap( ebarp_new )
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( .not. newton(k) ) cycle
+        i = idx(k)
+        term1 = (q_new(k)/sbar_new(k))*(q_new(k)/sbar_new(k))
+        term2 = two * q1(i) * f_new(k) *
+     &          cosh(onehalf*q2(i)*p_new(k)/sbar_new(k))
+        term3 = one + q3(i) * f_new(k) * f_new(k)
+        phi   = term1 + term2 - term3
+        beta = -onehalf * q2(i)
+        ch   = cosh( beta*p_new(k)/sbar_new(k) )
+        sh   = sinh( beta*p_new(k)/sbar_new(k) )
+        gp = two * beta * f_new(k) * q1(i) * sh / sbar_new(k)
+        gq = two * q_new(k) / sbar_new(k)**2
+        gsbar = (two / sbar_new(k)**3 ) *
+     &          ( -q_new(k)*q_new(k) - beta * f_new(k) * p_new(k) *
+     &          q1(i) * sbar_new(k) * sh )
+        gf = two * ( -f_new(k) * q3(i) + q1(i) * ch)
+        d_ebarp = ebarp_new(k) - ebarp(k)
+        a1 = one / ( one + dep(k) ) -
+     &       ( dep(k) + f(k) + d_ebarp * a_nuc(k) ) /
+     &       ( one + dep(k) )**2
+        a1 = -a1
+        a2 = d_ebarp * a_prime(k)  / ( one + dep(k) )
+        b1 = ( -p_new(k) * dep(k) + q_new(k) * deq(k) ) /
+     &       sbar_new(k) / ( one - f_new(k) )**2
+        b2 = ( -p_new(k) - bulk_mod(k) * dep(k) ) / sbar_new(k) /
+     &       ( one - f_new(k) )
+        b3 = ( -p_new(k) * dep(k) + q_new(k) * deq(k) ) * h_new(k) /
+     &       ( one - f_new(k) ) / sbar_new(k)**2
+        df_dep     = ( a1 - a2 * b2 + a1 * b3 ) / ( a2 * b1 - b3 - one )
+        debarp_dep = ( b2 - a1 * b1 ) / ( one - a2 * b1 + b3 )
+        b4 = d_ebarp * a_prime(k) / ( one + dep(k) )
+        b5 = ( q_new(k) - three * shear_mod(k) * deq(k) ) /
+     &       ( one - f_new(k) ) / sbar_new(k)
+        df_deq     = b4 * b5 / ( one + b3 - b1 * b4 )
+        debarp_deq = b5 / ( one + b3 - b1 * b4 )
+        d21 = gp * bulk_mod(k)   +    gf * df_dep   +
+     &        h_new(k) * gsbar * debarp_dep
+        d22 = -three * shear_mod(k) * gq + h_new(k) * gsbar *
+     &        debarp_deq + gf *  df_deq
+        beta  = -onehalf * q2(i)
+        alpha = two * beta * q1(i)
+        term1 = two * q_new(k) / sbar_new(k)**2
+        term2 = alpha * deq(k) * sh * df_dep / sbar_new(k)
+        term3 = ( ( four * dep(k) * q_new(k) / sbar_new(k)**3  ) +
+     &          alpha * deq(k) * f_new(k) * sh / sbar_new(k)**2 ) *
+     &          h_new(k) * debarp_dep
+        term4 = alpha * beta * f_new(k) * deq(k) * ch *
+     &          ( bulk_mod(k) * sbar_new(k) - p_new(k) * h_new(k) *
+     &          debarp_dep ) / sbar_new(k)**3
+        d11   = term1 + term2 - term3 + term4
+        term1 = three * three * shear_mod(k) * dep(k) / sbar_new(k)**2
+        term2 = alpha * f_new(k) * sh / sbar_new(k)
+        term3 = alpha * deq(k) * sh * df_deq / sbar_new(k)
+        term4 = ( four * dep(k) * q_new(k) / sbar_new(k)**3 +
+     &          alpha * deq(k) * f_new(k) * sh / sbar_new(k)**2 ) *
+     &          h_new(k) * debarp_deq
+        term5 = alpha * beta * deq(k) * f_new(k) * p_new(k) * ch *
+     &          h_new(k) * debarp_deq / sbar_new(k)**3
+        d12   = -term1 + term2 + term3 - term4 - term5
+c
+        r1 = dep(k) * gq + deq(k) * gp
+        r2 = phi
+        del_dep = (d12*r2 - d22*r1 ) / (d11*d22 - d12*d21)
+        del_deq = (d21*r1 - d11*r2) / (d11*d22 - d12*d21)
+        dep(k)  = dep(k) + del_dep
+        deq(k)  = deq(k) + del_deq
+c
+        converge    = .true.
+        eps_compare = toler * max( abs(dep(k)), abs(deq(k)), eps_o(k) )
+        if( abs( dep(k) - dep_old(k) ) .gt. eps_compare )
+     &      converge = .false.
+        if( abs( deq(k) - deq_old(k) ) .gt. eps_compare )
+     &      converge = .false.
+        if( abs(r2) .gt. tol_yf*sig_y(k) ) converge = .false.
+        if( converge ) then
+          newton(k) = .false.
+          cycle
+        end if
+        dep_old(k) = dep(k)
+        deq_old(k) = deq(k)
+      end do
+c
+      end do
+c
+c              no convergence in 30 iterations (gt_converge = 2)
+c
+      do k = 1, nv
+        if( sub_active(k) .and. newton(k) ) status(k) = 4
+      end do
+c
+c              4. radial return to the yield surface (mm03s @ 1000),
+c                 energy and state for the next subincrement (mm03).
+c
+      do k = 1, nv
+        if( .not. sub_active(k) .or. status(k) .ne. 0 ) cycle
+        i = idx(k)
+        dep_last_sub(k) = dep(k)
+        deq_last_sub(k) = deq(k)
+        newsig(1:6) = stress_n1(1:6,i)
+        smel   = -one * p_trial(k)
+        std(1) = newsig(1) - smel
+        std(2) = newsig(2) - smel
+        std(3) = newsig(3) - smel
+        std(4) = newsig(4)
+        std(5) = newsig(5)
+        std(6) = newsig(6)
+        if( deq(k) .gt. zero ) then
+          scale = three * shear_mod(k) * deq(k) / q_trial(k)
+          newsig(1) = newsig(1) - scale * std(1)
+          newsig(2) = newsig(2) - scale * std(2)
+          newsig(3) = newsig(3) - scale * std(3)
+          newsig(4) = newsig(4) - scale * std(4)
+          newsig(5) = newsig(5) - scale * std(5)
+          newsig(6) = newsig(6) - scale * std(6)
+        end if
+        newsig(1) = newsig(1) - bulk_mod(k) * dep(k)
+        newsig(2) = newsig(2) - bulk_mod(k) * dep(k)
+        newsig(3) = newsig(3) - bulk_mod(k) * dep(k)
+        stress_n1(1:6,i) = newsig(1:6)
+        chk1 = mm03f( newsig, sbar_new(k), f_new(k), q1(i), q2(i),
+     &                q3(i) )
+        if( abs(chk1) .gt. tol_yf * sig_y(k) ) then
+          nchk(k) = nchk(k) + 1
+          chk_val(k,min(nchk(k),max_sub)) = chk1
+        end if
+        dsenrg = deps_sub(k,1) * ( stress_start(k,1)+stress_n1(1,i) ) +
+     &           deps_sub(k,2) * ( stress_start(k,2)+stress_n1(2,i) ) +
+     &           deps_sub(k,3) * ( stress_start(k,3)+stress_n1(3,i) ) +
+     &           deps_sub(k,4) * ( stress_start(k,4)+stress_n1(4,i) ) +
+     &           deps_sub(k,5) * ( stress_start(k,5)+stress_n1(5,i) ) +
+     &           deps_sub(k,6) * ( stress_start(k,6)+stress_n1(6,i) )
+        senerg(k)    = senerg(k) + dsenrg * half
+        ebarp(k)     = ebarp_new(k)
+        sbar(k)      = sbar_new(k)
+        f(k)         = f_new(k)
+        total_dep(k) = total_dep(k) + dep(k)
+        total_deq(k) = total_deq(k) + deq(k)
+        stress_start(k,1:6) = stress_n1(1:6,i)
+      end do
+c
+      end do  ! on subincrements
+c
+c              5. history, plastic strain increments and plastic
+c                 work for the updated points (mm03 after the
+c                 subincrements).
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( status(k) .ne. 0 ) cycle
+        i = idx(k)
+        stress_n1(7,i) = senerg(k)
+        history1(i,1,gpn) = ebarp_new(k)
+        history1(i,2,gpn) = sbar_new(k)
+        history1(i,3,gpn) = p_new(k)
+        history1(i,4,gpn) = h_new(k)
+        history1(i,5,gpn) = f_new(k)
+        history1(i,7,gpn) = total_dep(k)
+        history1(i,8,gpn) = total_deq(k)
+        history1(i,9,gpn) = q_new(k)
+        dsig(1) = stress_n1(1,i) - stress_n(1,i)
+        dsig(2) = stress_n1(2,i) - stress_n(2,i)
+        dsig(3) = stress_n1(3,i) - stress_n(3,i)
+        dsig(4) = stress_n1(4,i) - stress_n(4,i)
+        dsig(5) = stress_n1(5,i) - stress_n(5,i)
+        dsig(6) = stress_n1(6,i) - stress_n(6,i)
+        deps_plas(1) = deps(i,1) - (dsig(1) - nu(i)*(dsig(2)+dsig(3)))
+     &                 / e(i)
+        deps_plas(2) = deps(i,2) - (dsig(2) - nu(i)*(dsig(1)+dsig(3)))
+     &                 / e(i)
+        deps_plas(3) = deps(i,3) - (dsig(3) - nu(i)*(dsig(1)+dsig(2)))
+     &                 / e(i)
+        deps_plas(4) = deps(i,4) - dsig(4) / shear_mod(k)
+        deps_plas(5) = deps(i,5) - dsig(5) / shear_mod(k)
+        deps_plas(6) = deps(i,6) - dsig(6) / shear_mod(k)
+        history1(i,10,gpn) = history(i,10,gpn) + deps(i,1) -
+     &                       deps_plas(1)
+        history1(i,11,gpn) = history(i,11,gpn) + deps(i,2) -
+     &                       deps_plas(2)
+        history1(i,12,gpn) = history(i,12,gpn) + deps(i,3) -
+     &                       deps_plas(3)
+        history1(i,13,gpn) = history(i,13,gpn) + deps(i,4) -
+     &                       deps_plas(4)
+        history1(i,14,gpn) = history(i,14,gpn) + deps(i,5) -
+     &                       deps_plas(5)
+        history1(i,15,gpn) = history(i,15,gpn) + deps(i,6) -
+     &                       deps_plas(6)
+        stress_n1(8,i) = stress_n(8,i)  +  half * (
+     &       deps_plas(1) * (stress_n1(1,i) + stress_n(1,i))
+     &     + deps_plas(2) * (stress_n1(2,i) + stress_n(2,i))
+     &     + deps_plas(3) * (stress_n1(3,i) + stress_n(3,i))
+     &     + deps_plas(4) * (stress_n1(4,i) + stress_n(4,i))
+     &     + deps_plas(5) * (stress_n1(5,i) + stress_n(5,i))
+     &     + deps_plas(6) * (stress_n1(6,i) + stress_n(6,i)) )
+        factor1 = ( deps_plas(1) - deps_plas(2) )**2  +
+     &            ( deps_plas(2) - deps_plas(3) )**2  +
+     &            ( deps_plas(1) - deps_plas(3) )**2
+        factor2 = deps_plas(4)**2 +  deps_plas(5)**2 +
+     &            deps_plas(6)**2
+        deps_plas_bar =  (root2/three) * sqrt( factor1 +
+     &                   (three/two)*factor2 )
+        stress_n1(9,i) = stress_n(9,i) + deps_plas_bar
+      end do
+c
+c              6. state flag -> plastic (1) and the messages mm03
+c                 and its routines write, in the order of the plastic
+c                 list. a large strain increment or failed iterations
+c                 request a step cut (or stop the run).
+c
+      do k = 1, nv
+        i = idx(k)
+        dword = history(i,6,gpn)
+        state = iword(1)
+        if( big_eps(k) ) then
+          if( signal ) write(iout,9021) felem+i-1, gpn, eps_ratio(k)
+          if( allow_cut ) then
+            cut_step = .true.
+            write(iout,9040) felem+i-1, gpn, eps_ratio(k)
+            cycle
+          else
+            write(iout,9042)
+            call abort_job
+          end if
+        end if
+        if( state .ne. 1 .and. signal )
+     &    write(iout,9017) felem+i-1, gpn, yld_func(i)
+        do j = 1, min( nchk(k), max_sub )
+          write(iout,9300) felem+i-1, gpn, chk_val(k,j)
+        end do
+        if( ss_msg(k) .eq. 1 ) write(iout,9400) felem+i-1, gpn
+        if( ss_msg(k) .eq. 2 ) write(iout,9410) felem+i-1, gpn
+        if( status(k) .ge. 3 ) then
+          if( allow_cut ) then
+            cut_step = .true.
+            write(iout,9050) felem+i-1, gpn, status(k)-2
+            cycle
+          else
+            write(iout,9060) felem+i-1, gpn, status(k)-2
+            call abort_job
+          end if
+        end if
+        iword(1) = 1
+        history1(i,6,gpn) = dword
+      end do
+c
+      return
+c
+ 9017 format(10x,i5,i3,' point yields.  f    = ',f12.3 )
+ 9021 format(10x,i5,i3,' large strain incr. / eps_o =',f12.3 )
+ 9040 format(
+     &/,3x,'>> Warning: strain increment too large.',
+     &/,3x,'            material model requesting step size reduction.',
+     &/,3x,'            element, gauss point, deps / eps_o: ',
+     &             i8,i3, f12.3 )
+ 9042 format(
+     &/,3x,'>> Warning: strain increment too large.',
+     &/,3x,'            load step reduction not enabled.,'
+     &/,3x,'            analysis terminated.' )
+ 9050 format(
+     &/,3x,'>> Warning: iterations for gurson model failed.',
+     &/,3x,'            material model requesting step size reduction.',
+     &/,3x,'            element, gauss point, gt-flag: ',i8,i3,i3 )
+ 9060 format(
+     &/,3x,'>> FATAL ERROR: iterations for gurson model failed.',
+     &/,3x,'                did not converge in 30 iterations.',
+     &/,3x,'                load step reduction not enabled.,'
+     &/,3x,'                analysis terminated.',
+     &/,3x,'                element, gauss point, gt-flag: ',i8,i3,i3 )
+ 9300 format(/,'>>>> Warning: routine mm03s. invalid update of',
+     &       /,'              Gurson model. yield surface not',
+     &       /,'              satisfied. element, point: ',2i8,
+     &       /,'              yield function: ',e14.6)
+ 9400 format(10x,i7,i3,' newton loop in mm03ss failed to converge')
+ 9410 format(10x,i4,i3,' f_new < 0 during update')
+c
+      contains
+c     ========
+c
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03gv_sb -- matrix equivalent stress and plastic        *
+c *                          modulus for the masked points (mm03sb)      *
+c *                                                                      *
+c ************************************************************************
+c
+      subroutine mm03gv_sb( ebarp_x )
+      implicit none
+c
+      double precision :: ebarp_x(*)
+c
+      integer :: k
+      double precision :: d_eb, rate_multiplier, t0, t1r, t2r
+c
+      do k = 1, nv
+        pl_eval(k) = eval(k) .and. .not. consth(k)
+      end do
+      if( any( pl_eval(1:nv) ) )
+     &  call mm03is_v( nv, pl_eval, ebarp_x, sig_y, e_pt, n_pow,
+     &                 sb_inv, h_inv )
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( .not. eval(k) ) cycle
+        if( consth(k) ) then
+          sb_inv(k) = sig_y(k) + h_constant(k) * ebarp_x(k)
+          h_inv(k)  = h_constant(k)
+        end if
+        if( rate_depen(k) ) then
+          d_eb = ebarp_x(k) - ebarp(k)
+          rate_multiplier = ( eps_ref(idx(k)) * d_eb/dtime + one )**
+     &                      mpoweri(k)
+          sbar_new(k) = sb_inv(k) * rate_multiplier
+          t0  = ( sbar_new(k) / sb_inv(k) ) ** (one - m_power(idx(k)) )
+          t1r = t0 * eps_ref(idx(k)) * sb_inv(k) / m_power(idx(k)) /
+     &          dtime
+          t2r = h_inv(k) * sbar_new(k) / sb_inv(k)
+          h_new(k) = t1r + t2r
+        else
+          sbar_new(k) = sb_inv(k)
+          h_new(k)    = h_inv(k)
+        end if
+      end do
+c
+      return
+      end subroutine mm03gv_sb
+c
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03gv_ap -- nucleation function and its derivative for  *
+c *                          the masked points (mm03ap)                  *
+c *                                                                      *
+c ************************************************************************
+c
+      subroutine mm03gv_ap( ebarp_x )
+      implicit none
+c
+      double precision :: ebarp_x(*)
+c
+      integer :: k, i
+      double precision :: ta, tb
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( .not. eval(k) ) cycle
+        a_nuc(k)   = zero
+        a_prime(k) = zero
+        i = idx(k)
+        if( .not. nucleation(i) ) cycle
+        ta = nuc_f_n(i) / nuc_s_n(i) / root_2_pi
+        tb = ( ( ebarp_x(k) - nuc_e_n(i) ) / nuc_s_n(i) )**2
+        a_nuc(k)   = ta * exp(-half*tb)
+        a_prime(k) = -nuc_f_n(i) * (ebarp_x(k)-nuc_e_n(i)) /
+     &               nuc_s_n(i)**3 / root_2_pi
+        a_prime(k) = a_prime(k) * exp(-half*tb)
+      end do
+c
+      return
+      end subroutine mm03gv_ap
+c
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03gv_us -- ebarp_new, sbar_new, f_new for the newton   *
+c *                          points (mm03us)                             *
+c *                                                                      *
+c ************************************************************************
+c
+      subroutine mm03gv_us
+      implicit none
+c
+      integer :: k, loop_us
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        conv(k)      = .false.
+        us_active(k) = newton(k)
+        if( .not. newton(k) ) cycle
+        t_numer(k)      = -p_new(k) * dep(k) + q_new(k) * deq(k)
+        ebarp_new(k)    = ebarp(k) + t_numer(k) / ( one - f(k) ) /
+     &                    sbar(k)
+        strain_toler(k) = tol_us * max( eps_o(k), ebarp_new(k) )
+      end do
+c
+      do loop_us = 1, 10
+       if( .not. any( us_active(1:nv) ) ) exit
+       eval(1:nv) = us_active(1:nv)
+       call mm03gv_sb( ebarp_new )
+       call mm03gv_ap( ebarp_new )
+!DIR$ IVDEP
+       do k = 1, nv
+        if( .not. us_active(k) ) cycle
+        d_ebarp = ebarp_new(k) - ebarp(k)
+        term1   = dep(k) + f(k) + a_nuc(k)*d_ebarp
+        term2   = sbar_new(k) * ( one - term1/(one + dep(k)) )
+        r       = d_ebarp - t_numer(k) / term2
+        term1   = (one-dep(k)) * t_numer(k) *
+     &            ( a_nuc(k) + d_ebarp * a_prime(k) )
+        term2   = (one - f(k) - ebarp(k) * a_nuc(k) +
+     &             ebarp_new(k) * a_nuc(k))
+        term3   = (one+dep(k)) * t_numer(k) * h_new(k)
+        dr_ebarp = one - term1 / term2 / term2 / sbar_new(k) +
+     &             term3 / term2 / sbar_new(k) / sbar_new(k)
+        eps_correction = r / dr_ebarp
+        if( abs(eps_correction) .le. strain_toler(k) ) then
+          us_active(k) = .false.
+          f_new(k) = (f(k) + dep(k) + a_nuc(k) * d_ebarp) /
+     &               ( one + dep(k) )
+          conv(k)  = .not. ( f_new(k) .lt. zero ) .and.
+     &               .not. ( ebarp_new(k) .lt. ebarp(k) )
+        else
+          ebarp_new(k) = ebarp_new(k) - eps_correction
+        end if
+       end do
+      end do
+c
+      return
+      end subroutine mm03gv_us
+c
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03gv_ss -- bracketed newton-bisection for ebarp_new    *
+c *                          where mm03gv_us fails (mm03ss)              *
+c *                                                                      *
+c ************************************************************************
+c
+      subroutine mm03gv_ss
+      implicit none
+c
+      integer :: k, loop_ss
+c
+c              bracket ebarp_new between ebarp and ebarp_big
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        bound(k)     = ss_mask(k)
+        bracketed(k) = .false.
+        ss_iter(k)   = .false.
+        ss_done0(k)  = .false.
+        ss_done(k)   = .false.
+        if( .not. ss_mask(k) ) cycle
+        t1(k)           = -p_new(k) * dep(k) + q_new(k) * deq(k)
+        t3(k)           = one + dep(k)
+        t2(k)           = ( f(k) + dep(k) ) / t3(k)
+        ebarp_new(k)    = ebarp(k) + t1(k) / ( one - f(k) ) / sbar(k)
+        strain_toler(k) = tol_ss * max( eps_o(k), ebarp_new(k) )
+        ebarp_big(k)    = ebarp(k)
+      end do
+c
+      do loop_bound = 1, 5
+       if( .not. any( bound(1:nv) ) ) exit
+       eval(1:nv) = bound(1:nv)
+       call mm03gv_sb( ebarp_big )
+       call mm03gv_ap( ebarp_big )
+       do k = 1, nv
+        if( .not. bound(k) ) cycle
+        d_ebarp = ebarp_big(k) - ebarp(k)
+        term1   = sbar_new(k) * ( one - t2(k) - a_nuc(k)*d_ebarp/t3(k) )
+        r       = d_ebarp - t1(k) / term1
+        if( loop_bound .eq. 1 ) then
+          r_low(k) = r
+          if( ebarp(k) .eq. zero ) ebarp_big(k) = eps_o(k)
+        else if( r * r_low(k) .le. zero ) then
+          r_high(k)    = r
+          bound(k)     = .false.
+          bracketed(k) = .true.
+          cycle
+        end if
+        ebarp_big(k) = ebarp_big(k) * sfactors(loop_bound)
+       end do
+      end do
+c
+c              points not bracketed fail (conv stays false)
+c
+      do k = 1, nv
+        if( .not. bracketed(k) ) cycle
+        if( r_low(k) .eq. zero ) then
+          ebarp_new(k) = ebarp(k)
+          ss_done0(k)  = .true.
+        else if( r_high(k) .eq. zero ) then
+          ebarp_new(k) = ebarp_big(k)
+          ss_done0(k)  = .true.
+        else
+          if( r_low(k) .lt. zero ) then
+            ebarp_low(k)  = ebarp(k)
+            ebarp_high(k) = ebarp_big(k)
+          else
+            ebarp_high(k) = ebarp(k)
+            ebarp_low(k)  = ebarp_big(k)
+          end if
+          ebarp_new(k) = ( ebarp_low(k) + ebarp_high(k) ) * half
+          ebarp_old(k) = ebarp_new(k)
+          deps_old(k)  = abs( ebarp_low(k) - ebarp_high(k) )
+          deps_nb(k)   = deps_old(k)
+          ss_iter(k)   = .true.
+        end if
+      end do
+c
+      eval(1:nv) = ss_iter(1:nv)
+      if( any( eval(1:nv) ) ) then
+        call mm03gv_sb( ebarp_new )
+        call mm03gv_ap( ebarp_new )
+        call mm03gv_ss_r( .false. )
+      end if
+c
+c              newton-bisection iterations
+c
+      do loop_ss = 1, 12
+       if( .not. any( ss_iter(1:nv) ) ) exit
+       do k = 1, nv
+        if( .not. ss_iter(k) ) cycle
+        term1 = ( ebarp_new(k) - ebarp_high(k) ) * dr_nb(k) - r_nb(k)
+        term2 = ( ebarp_new(k) - ebarp_low(k)  ) * dr_nb(k) - r_nb(k)
+        if( term1*term2 .ge. zero .or.
+     &      abs(two*r_nb(k)) .gt. abs(deps_old(k)*dr_nb(k)) ) then
+          deps_old(k)  = deps_nb(k)
+          deps_nb(k)   = half * ( ebarp_high(k) - ebarp_low(k) )
+          ebarp_new(k) = ebarp_low(k) + deps_nb(k)
+          if( ebarp_low(k) .eq. ebarp_new(k) ) then
+            ss_iter(k) = .false.
+            ss_done(k) = .true.
+            cycle
+          end if
+        else
+          deps_old(k)  = deps_nb(k)
+          deps_nb(k)   = r_nb(k) / dr_nb(k)
+          temp         = ebarp_new(k)
+          ebarp_new(k) = ebarp_new(k) - deps_nb(k)
+          if( temp .eq. ebarp_new(k) ) then
+            ss_iter(k) = .false.
+            ss_done(k) = .true.
+            cycle
+          end if
+        end if
+        if( abs(ebarp_new(k)-ebarp_old(k)) .le. strain_toler(k) ) then
+          ss_iter(k) = .false.
+          ss_done(k) = .true.
+          cycle
+        end if
+        ebarp_old(k) = ebarp_new(k)
+       end do
+       eval(1:nv) = ss_iter(1:nv)
+       if( .not. any( eval(1:nv) ) ) exit
+       call mm03gv_sb( ebarp_new )
+       call mm03gv_ap( ebarp_new )
+       call mm03gv_ss_r( .true. )
+      end do
+c
+c              points still iterating did not converge
+c
+      do k = 1, nv
+        if( ss_iter(k) ) ss_msg(k) = 1
+      end do
+c
+c              converged (mm03ss @ 1000). after the bracket only
+c              (loop = 0 in mm03ss) the state is for ebarp_new yet
+c              to be found.
+c
+      eval(1:nv) = ss_done0(1:nv)
+      if( any( eval(1:nv) ) ) then
+        call mm03gv_sb( ebarp_new )
+        call mm03gv_ap( ebarp_new )
+      end if
+c
+      do k = 1, nv
+        if( .not. ( ss_done(k) .or. ss_done0(k) ) ) cycle
+        d_ebarp  = ebarp_new(k) - ebarp(k)
+        f_new(k) = t2(k) + a_nuc(k) * d_ebarp / t3(k)
+        conv(k)  = .true.
+        if( f_new(k) .lt. zero ) then
+          ss_msg(k) = 2
+          conv(k)   = .false.
+        end if
+      end do
+c
+      return
+      end subroutine mm03gv_ss
+c
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03gv_ss_r -- residual of mm03ss and its derivative at  *
+c *                            ebarp_new, new bounds                     *
+c *                                                                      *
+c ************************************************************************
+c
+      subroutine mm03gv_ss_r( new_bounds )
+      implicit none
+c
+      logical :: new_bounds
+c
+      integer :: k
+      double precision :: tn1, tn2, tn3, tn4, d_eb
+c
+!DIR$ IVDEP
+      do k = 1, nv
+        if( .not. eval(k) ) cycle
+        d_eb     = ebarp_new(k) - ebarp(k)
+        tn1      = sbar_new(k) * ( one - t2(k) - a_nuc(k)*d_eb/t3(k) )
+        r_nb(k)  = d_eb - t1(k) / tn1
+        tn1      = t1(k) * ( -a_nuc(k)/t3(k) - a_prime(k)*d_eb/t3(k) )
+        tn2      = sbar_new(k) *
+     &             (one - t2(k) - a_nuc(k)*d_eb/t3(k))**2
+        tn3      = t1(k) * h_new(k)
+        tn4      = sbar_new(k) * sbar_new(k) *
+     &             (one - t2(k) - a_nuc(k)*d_eb/t3(k))
+        dr_nb(k) = one + tn1/tn2 + tn3/tn4
+        if( .not. new_bounds ) cycle
+        if( r_nb(k) .lt. zero ) then
+          ebarp_low(k)  = ebarp_new(k)
+        else
+          ebarp_high(k) = ebarp_new(k)
+        end if
+      end do
+c
+      return
+      end subroutine mm03gv_ss_r
+      end subroutine mm03gv
 c *******************************************************************
 c *                                                                 *
 c *      material model # 03 routine -- mm03f                       *
@@ -1074,6 +2434,123 @@ c
       return
 c
       end
+c ************************************************************************
+c *                                                                      *
+c *    routine  mm03is_v -- linear + power law uniaxial response for a   *
+c *                         list of points (mm03is in lockstep)          *
+c *                         updated: 10/19/2026 agent                    *
+c *                                                                      *
+c ************************************************************************
+c
+c
+      subroutine mm03is_v( n, eval, eps_pls, sigma_o, e, power, value,
+     &                     hprime )
+      implicit none
+      include 'param_def'
+c
+c              parameters
+c
+      integer :: n
+      logical :: eval(*)
+      double precision :: eps_pls(*), sigma_o(*), e(*), power(*),
+     &                    value(*), hprime(*)
+c
+c              locals
+c
+      integer :: k, iterno
+      integer, parameter :: max_itr = 20
+      logical :: active(mxvl), converge
+      double precision :: sig_o(mxvl), eps_o(mxvl), poweri(mxvl),
+     &   eps_a(mxvl), eps_b(mxvl), h(mxvl), h2(mxvl), h3(mxvl),
+     &   sig_a(mxvl), sig_b(mxvl), epower(mxvl), pm1(mxvl),
+     &   et_b(mxvl), strain(mxvl), stress(mxvl), stress_new, fprime,
+     &   ta, tb, n1, n2, n3, n4, pn1, pn2, pn3, pn4, resid, deps, et,
+     &   strain_new
+      double precision, parameter ::
+     &   zero = 0.d0, one = 1.d0, two = 2.d0, three = 3.d0,
+     &   beta = 0.95d0, alpha = 1.1d0, toler = 0.000001d0
+c
+c              the newton iteration of mm03is on strain for the points
+c              with eval set. all points take their iterations
+c              together; a point leaves the active mask where mm03is
+c              would return. same arithmetic as mm03is.
+c
+!DIR$ IVDEP
+      do k = 1, n
+        active(k) = .false.
+        if( .not. eval(k) ) cycle
+        if( eps_pls(k) <= zero ) then
+          value(k)  = sigma_o(k)
+          hprime(k) = e(k) * (0.9999d0*e(k)) / ( e(k)-0.9999d0*e(k) )
+          cycle
+        end if
+        sig_o(k)  = sigma_o(k) / beta
+        eps_o(k)  = sig_o(k) / e(k)
+        poweri(k) = one / power(k)
+        eps_a(k)  = beta  * eps_o(k)
+        eps_b(k)  = alpha * eps_o(k)
+        h(k)      = eps_b(k) - eps_a(k)
+        h2(k)     = h(k) * h(k)
+        h3(k)     = h2(k) * h(k)
+        sig_a(k)  = beta * sig_o(k)
+        sig_b(k)  = sig_o(k) * alpha**poweri(k)
+        epower(k) = e(k) / power(k)
+        pm1(k)    = poweri(k)-one
+        et_b(k)   = epower(k) * alpha**pm1(k)
+        strain(k) = eps_pls(k) + eps_o(k)
+        stress(k) = zero
+        active(k) = .true.
+      end do
+c
+      do iterno = 1, max_itr
+       if( .not. any( active(1:n) ) ) exit
+!DIR$ IVDEP
+       do k = 1, n
+        if( .not. active(k) ) cycle
+        if( strain(k) >= eps_b(k) ) then
+           stress_new = sig_o(k) * ( strain(k)/eps_o(k) )**poweri(k)
+           fprime     = epower(k) * ( strain(k)/eps_o(k) )**pm1(k)
+        else
+           ta = strain(k) - eps_a(k)
+           tb = strain(k) - eps_b(k)
+           n1 = -tb*tb * (-h(k) - two*ta) / h3(k)
+           n2 =  ta * tb * tb / h2(k)
+           n3 =  ta * ta * (h(k) - two*tb) / h3(k)
+           n4 =  ta * ta * tb / h2(k)
+           stress_new = n1*sig_a(k) + n3*sig_b(k) + n2*e(k) + n4*et_b(k)
+           pn1 = two*(tb)*(three*strain(k)-two*eps_a(k)-eps_b(k)+h(k))
+     &           /h3(k)
+           pn3 = two*(ta)*(-three*strain(k)+eps_a(k)+two*eps_b(k)+h(k))
+     &           /h3(k)
+           pn2 = -tb*(-three*strain(k)+two*eps_a(k)+eps_b(k))/h2(k)
+           pn4 = -ta*(-three*strain(k)+eps_a(k)+two*eps_b(k))/h2(k)
+           fprime = pn1*sig_a(k) + pn3*sig_b(k) + pn2*e(k) +
+     &              pn4*et_b(k)
+        end if
+        resid      = strain(k) - stress_new/e(k) - eps_pls(k)
+        deps       = -resid / ( one - fprime/e(k) )
+        strain_new = strain(k) + deps
+        converge = abs( strain_new - strain(k) ) .lt. toler * strain_new
+     &                              .and.
+     &             abs( stress_new - stress(k) ) .lt. toler * stress_new
+        if( converge ) then
+          et        = fprime
+          hprime(k) = ( e(k) * et ) / ( e(k) - et )
+          value(k)  = stress_new
+          active(k) = .false.
+        elseif( iterno .eq. max_itr ) then
+          value(k)  = sig_o(k)
+          hprime(k) = e(k) * e(k)
+          active(k) = .false.
+        else
+          strain(k) = strain_new
+          stress(k) = stress_new
+        end if
+       end do
+      end do
+c
+      return
+      end subroutine mm03is_v
 c *******************************************************************
 c *                                                                 *
 c *      material model # 03 routine -- mm03ap                      *
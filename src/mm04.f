@@ -2343,7 +2343,7 @@ c    *                   subroutine mm04_exp1_secant                *
 c    *                                                              *
 c    *                       written by : A Roy,                    *
 c    *                                    S. Roychowdhury           *
-c    *                    last modified : 7/3/2013 rhd              *
+c    *                    last modified : 10/19/2026 agent          *
 c    *                                                              *
 c    *     computes the secant stiffness for a block of cohesive    *
 c    *     elements for the exponential traction-separation model   *
@@ -2368,7 +2368,8 @@ c
       double precision
      & zero, tol, dtol, d_eff_at_peak, beta, dt1, dt2, dn, b2,
      & effdis(mxvl), efftrac(mxvl), e, maxeffdis(mxvl),
-     & prior_max_d_eff, d_eff_at_n, peak_intf_stress, comp_multiplier
+     & prior_max_d_eff, d_eff_at_n, peak_intf_stress, comp_multiplier,
+     & deff, trac, decay, k_norm, k_comp, t1, t3_tens, t3_comp, one
        logical compression(mxvl), small_effdis(mxvl), loading(mxvl),
      &         local_debug
 c
@@ -2410,8 +2411,8 @@ c
       local_debug = .false.
 c
 !DIR$ LOOP COUNT MAX=128
+!DIR$ IVDEP
       do i = 1, span
-        if( elem_killed(i) ) cycle
         d_eff_at_peak   = intfprps(i,11)
         beta            = intfprps(i,12)
         d_eff_at_n      = history(i,1)
@@ -2428,55 +2429,47 @@ c
      &               effdis(i) .eq. maxeffdis(i)
       end do
 c
-      do k = 1, span
-c
-        cohmat(k,1:3) = zero
-        if( elem_killed(k) ) cycle
+c         secant values for all cases (small, loading, unloading,
+c         each with/without compression) are formed and the one
+c         that governs is picked by mask - no branches in the loop.
+c         each candidate is evaluated in the same order as the
+c         prior if-block form so results are unchanged. effdis is
+c         swapped for one at small points to keep unused candidates
+c         finite. killed elements get zero stiffness.
 c
+!DIR$ LOOP COUNT MAX=128
+!DIR$ IVDEP
+      do k = 1, span
         peak_intf_stress = intfprps(k,5)
         d_eff_at_peak    = intfprps(k,11)
         beta             = intfprps(k,12)
         comp_multiplier  = intfprps(k,22)
-c
-        if( small_effdis(k) ) then
-              cohmat(k,1) = e*beta**2*peak_intf_stress
-     &                      /d_eff_at_peak
-              cohmat(k,2) = cohmat(k,1)
-              cohmat(k,3) = e*peak_intf_stress/d_eff_at_peak
-              if( compression(k) )
-     &          cohmat(k,3) = cohmat(k,3) * comp_multiplier
-              efftrac(k) = zero
-              cycle
-        end if
-c
-        efftrac(k) = e*peak_intf_stress*effdis(k)/d_eff_at_peak*
-     &               e**(-one*effdis(k)/d_eff_at_peak)
-        b2   = beta * beta
-        if( loading(k) ) then
-           if ( compression(k) ) then
-               cohmat(k,1) = efftrac(k)/effdis(k)*b2
-               cohmat(k,2) = cohmat(k,1)
-               cohmat(k,3) = e*peak_intf_stress/d_eff_at_peak
-               cohmat(k,3) = cohmat(k,3) * comp_multiplier
-           else
-               cohmat(k,1) = efftrac(k)/effdis(k)*b2
-               cohmat(k,2) = cohmat(k,1)
-               cohmat(k,3) = efftrac(k)/effdis(k)
-           end if
-        else  ! unloading. can still be compression
-           cohmat(k,1) = e*b2*peak_intf_stress
-     &                   /d_eff_at_peak*exp(-one*maxeffdis(k)
-     &                   /d_eff_at_peak)
-           cohmat(k,2) = cohmat(k,1)
-           if ( compression(k) ) then
-             cohmat(k,3) = comp_multiplier *
-     &                     e*peak_intf_stress/d_eff_at_peak
-           else
-             cohmat(k,3) = e*peak_intf_stress/d_eff_at_peak
-     &                   *exp(-one*maxeffdis(k)/d_eff_at_peak)
-           end if
-        end if
-c
+        b2      = beta * beta
+        deff    = merge( one, effdis(k), small_effdis(k) )
+        trac    = e*peak_intf_stress*deff/d_eff_at_peak*
+     &            e**(-one*deff/d_eff_at_peak)
+        decay   = exp(-one*maxeffdis(k)/d_eff_at_peak)
+        k_norm  = e*peak_intf_stress/d_eff_at_peak
+        k_comp  = k_norm * comp_multiplier
+c
+        t1      = merge( trac/deff*b2,
+     &                   e*b2*peak_intf_stress/d_eff_at_peak*decay,
+     &                   loading(k) )
+        t3_tens = merge( trac/deff, k_norm*decay, loading(k) )
+        t3_comp = merge( k_comp,
+     &                   comp_multiplier*e*peak_intf_stress/
+     &                   d_eff_at_peak, loading(k) )
+        t1      = merge( e*beta**2*peak_intf_stress/d_eff_at_peak, t1,
+     &                   small_effdis(k) )
+        t3_tens = merge( k_norm, t3_tens, small_effdis(k) )
+        t3_comp = merge( k_comp, t3_comp, small_effdis(k) )
+c
+        cohmat(k,1) = merge( zero, t1, elem_killed(k) )
+        cohmat(k,2) = cohmat(k,1)
+        cohmat(k,3) = merge( zero,
+     &                       merge( t3_comp, t3_tens, compression(k) ),
+     &                       elem_killed(k) )
+        efftrac(k)  = merge( zero, trac, small_effdis(k) )
       end do
 c
 c                update history
@@ -3634,7 +3627,7 @@ c    *                                                              *
 c    *                       written by : A. Roy                    *
 c    *                                    S. Roychowdhury           *
 c    *                                                              *
-c    *                    last modified : 10/25/2015 rhd            *
+c    *                    last modified : 10/19/2026 agent          *
 c    *                                                              *
 c    *     computes the tangent [D] for a block of cohesive         *
 c    *     elements for the exponential traction-seperation law     *
@@ -3662,8 +3655,10 @@ c
      & t33, effdis(mxvl), efftrac, e, maxeffdis(mxvl),
      & dtd1, dtd2, dtd3, b2, b4, eff3,
      & dn, dt1, dt2, beta, prior_max_d_eff, d_eff_at_n,
-     & d_eff_at_peak, peak_intf_stress, comp_multiplier
-       logical compression(mxvl), small_effdis(mxvl), loading(mxvl)
+     & d_eff_at_peak, peak_intf_stress, comp_multiplier, deff,
+     & t_small, t_unl, t_comp, t33_small, t33_unl
+       logical compression(mxvl), small_effdis(mxvl), loading(mxvl),
+     &         full_tan
 c
        data zero, one, e, dtol
      & / 0.0d0, 1.0d0, 2.71828182845904523536d0, 0.000001d0  /
@@ -3704,7 +3699,6 @@ c
         write(iout,9000); write(iout,9005)
       end if
       do i = 1, span
-        if( elem_killed(i) ) cycle
         d_eff_at_peak   = intfprps(i,11)
         beta            = intfprps(i,12)
         d_eff_at_n      = history(i,1)
@@ -3727,76 +3721,90 @@ c
       end do
 c
 c
-      do k = 1, span
+c         branch-free over the span. all three regimes (small
+c         effdis, unloading, loading) are evaluated and selected by
+c         mask. expressions keep the evaluation order of the prior
+c         if-block form. effdis is swapped for one at small points
+c         so the loading terms stay finite there.
 c
-        if( elem_killed(k) ) cycle
+!DIR$ LOOP COUNT MAX=128
+!DIR$ IVDEP
+      do k = 1, span
 c
         peak_intf_stress = intfprps(k,5)
         d_eff_at_peak    = intfprps(k,11)
         beta             = intfprps(k,12)
         comp_multiplier  = intfprps(k,22)
+        full_tan = loading(k) .and. .not. small_effdis(k)
 c
-        if( small_effdis(k) ) then
-           tanmat(k,1,1) = e*beta**2*peak_intf_stress
-     &                     /d_eff_at_peak
-           tanmat(k,2,2) = tanmat(k,1,1)
-           tanmat(k,3,3) = e*peak_intf_stress/d_eff_at_peak
-           if( compression(k) )
-     &       tanmat(k,3,3) = comp_multiplier * tanmat(k,3,3)
-           cycle
-        end if
+c                small effdis and unloading (towards origin) cases.
+c                diagonal only. can still have compression
 c
-c                unloading case -- unload towards origin.
-c                can still have compression
-c
-        if( .not. loading(k) ) then
-           tanmat(k,1,1) = e*beta**2*peak_intf_stress/d_eff_at_peak
-     &                     *exp(-one*maxeffdis(k)/d_eff_at_peak)
-           tanmat(k,2,2) = tanmat(k,1,1)
-           tanmat(k,3,3) = tanmat(k,1,1)
-           if( compression(k) ) tanmat(k,3,3) =
-     &        comp_multiplier * e*peak_intf_stress/d_eff_at_peak
-           cycle
-        end if
+        t_small = e*beta**2*peak_intf_stress/d_eff_at_peak
+        t_unl   = e*beta**2*peak_intf_stress/d_eff_at_peak
+     &            *exp(-one*maxeffdis(k)/d_eff_at_peak)
+        t_comp  = comp_multiplier * e*peak_intf_stress/d_eff_at_peak
+        t33_small = e*peak_intf_stress/d_eff_at_peak
+        t33_small = merge( comp_multiplier * t33_small, t33_small,
+     &                     compression(k) )
+        t33_unl   = merge( t_comp, t_unl, compression(k) )
 c
 c                loading case -- can still have compression (rare)
 c
-        efftrac = e*peak_intf_stress*effdis(k)/d_eff_at_peak*
-     &            e**(-one*effdis(k)/d_eff_at_peak)
+        deff = merge( one, effdis(k), small_effdis(k) )
+        efftrac = e*peak_intf_stress*deff/d_eff_at_peak*
+     &            e**(-one*deff/d_eff_at_peak)
         dt1  = dis(k,1)  ! jump sliding 1
         dt2  = dis(k,2)  ! jump sliding 2
         dn   = dis(k,3)  ! jump normal
         b2   = beta * beta
         b4   = b2 * b2
-        eff3 = effdis(k)**3
+        eff3 = deff**3
 c
         dtd1 = e*b2*peak_intf_stress*dt1*
-     &            exp(-one*effdis(k)/d_eff_at_peak)*
-     &            (one-effdis(k)/d_eff_at_peak)/d_eff_at_peak
-     &            /effdis(k)
+     &            exp(-one*deff/d_eff_at_peak)*
+     &            (one-deff/d_eff_at_peak)/d_eff_at_peak
+     &            /deff
         dtd2 = e*b2*peak_intf_stress*dt2*
-     &            exp(-one*effdis(k)/d_eff_at_peak)*
-     &            (one-effdis(k)/d_eff_at_peak)/d_eff_at_peak
-     &            /effdis(k)
+     &            exp(-one*deff/d_eff_at_peak)*
+     &            (one-deff/d_eff_at_peak)/d_eff_at_peak
+     &            /deff
         dtd3 = e*peak_intf_stress*dn*
-     &            exp(-one*effdis(k)/d_eff_at_peak)*
-     &            (one-effdis(k)/d_eff_at_peak)/d_eff_at_peak
-     &            /effdis(k)
-        t11 = b2*efftrac/effdis(k)+ b2*dt1*dtd1/effdis(k)-
+     &            exp(-one*deff/d_eff_at_peak)*
+     &            (one-deff/d_eff_at_peak)/d_eff_at_peak
+     &            /deff
+        t11 = b2*efftrac/deff+ b2*dt1*dtd1/deff-
      &           b4*efftrac*dt1*dt1/eff3
-        t12 = b2*dt1*dtd2/effdis(k)- b4*efftrac*dt1*dt2/eff3
-        t21 = b2*dt2*dtd1/effdis(k)- b4*efftrac*dt2*dt1/eff3
-        t22 = b2*efftrac/effdis(k)+ b2*dt2*dtd2/effdis(k)-
+        t12 = b2*dt1*dtd2/deff- b4*efftrac*dt1*dt2/eff3
+        t21 = b2*dt2*dtd1/deff- b4*efftrac*dt2*dt1/eff3
+        t22 = b2*efftrac/deff+ b2*dt2*dtd2/deff-
      &           b4*efftrac*dt2*dt2/eff3
-        t13 = b2*dt1*dtd3/effdis(k)- b2*efftrac*dt1*dn/eff3
-        t23 = b2*dt2*dtd3/effdis(k)- b2*efftrac*dt2*dn/eff3
-        t31 = dn*dtd1/effdis(k)- b2*efftrac*dn*dt1/eff3
-        t32 = dn*dtd2/effdis(k)- b2*efftrac*dn*dt2/eff3
-        t33 = efftrac/effdis(k) + dn*dtd3/effdis(k)- efftrac*dn*dn/eff3
-        if( compression(k) ) then
-           t13 = zero; t23 = zero; t31 = zero; t32 = zero
-           t33 = comp_multiplier * e*peak_intf_stress/d_eff_at_peak
-        end if
+        t13 = b2*dt1*dtd3/deff- b2*efftrac*dt1*dn/eff3
+        t23 = b2*dt2*dtd3/deff- b2*efftrac*dt2*dn/eff3
+        t31 = dn*dtd1/deff- b2*efftrac*dn*dt1/eff3
+        t32 = dn*dtd2/deff- b2*efftrac*dn*dt2/eff3
+        t33 = efftrac/deff + dn*dtd3/deff- efftrac*dn*dn/eff3
+        t13 = merge( zero, t13, compression(k) )
+        t23 = merge( zero, t23, compression(k) )
+        t31 = merge( zero, t31, compression(k) )
+        t32 = merge( zero, t32, compression(k) )
+        t33 = merge( t_comp, t33, compression(k) )
+c
+c                pick regime. killed elements keep the zero [D]
+c
+        t11 = merge( t11, merge( t_small, t_unl, small_effdis(k) ),
+     &               full_tan )
+        t22 = merge( t22, merge( t_small, t_unl, small_effdis(k) ),
+     &               full_tan )
+        t33 = merge( t33, merge( t33_small, t33_unl, small_effdis(k) ),
+     &               full_tan )
+        t12 = merge( t12, zero, full_tan )
+        t21 = merge( t21, zero, full_tan )
+        t13 = merge( t13, zero, full_tan )
+        t23 = merge( t23, zero, full_tan )
+        t31 = merge( t31, zero, full_tan )
+        t32 = merge( t32, zero, full_tan )
+        if( elem_killed(k) ) cycle
         tanmat(k,1,1) = t11
         tanmat(k,1,2) = t12
         tanmat(k,2,1) = t21
@@ -330,7 +330,8 @@ c                       declare local variables
 c                       -----------------------
 c
        logical debug, yield(mxvl), prior_linear(mxvl)
-       integer i, j, iostat(mxvl), instat(mxvl)
+       integer i, j, iostat(mxvl), instat(mxvl), nplas,
+     &         plas_list(mxvl)
       double precision
      &     shear_mod_vec(mxvl), alpha_n(mxvl, nstrn),
      &     trace_eps_np1(mxvl),  yf_vec(mxvl), zero
@@ -360,16 +361,23 @@ c
 c              compute stresses and internal variables at n+1
 c              ----------------------------------------------
 c
+c              only the yielding points are passed through the
+c              return mapping (see mm05_plastic_list). the
+c              elastic points take the trial state below.
+c
 c       write(*,*) 'just before fa compute'
 c       write(*,*) (deps(1,j), j=1,6)
 c       write(*,*) 'sigy: ', sigyld_vec(1)
-       call mm05_fa_compute(
+       call mm05_plastic_list( span, yield, killed_status, nplas,
+     &                         plas_list )
+       if( nplas .gt. 0 )
+     &   call mm05_fa_compute(
      &    span, mxvl, debug, iout, history_n, history_np1,
-     &    mm_props, sigyld_vec, yield, e_vec, iter,
+     &    mm_props, sigyld_vec, e_vec, iter,
      &    stress_n, stress_np1, shear_mod_vec,
      &    adaptive_possible, cut_step_size_now, signal_flag,
      &    gpn, felem, step, deps, prior_linear, trial_elas_stress_np1,
-     &    killed_status)
+     &    nplas, plas_list )
 c
        if ( cut_step_size_now ) then
           return
@@ -639,7 +647,7 @@ c *******************************************************************
 c *                                                                 *
 c *        material model # 5 -- adv. cyclic plasticity model       *
 c *                                                                 *
-c *        mm05_fa_compute  -- last modified 12/18/2016 rhd         *
+c *        mm05_fa_compute  -- last modified 10/19/2026 agent       *
 c *                                                                 *
 c *        subincrementation based on truncation error with         *
 c *        extrapolation                                            *
@@ -647,18 +655,19 @@ c *                                                                 *
 c *******************************************************************
        subroutine mm05_fa_compute(
      &    span, mxvl, debug, iout, history_n, history_np1,
-     &    mm_props, sigyld_vec, yield, e_vec, iter,
+     &    mm_props, sigyld_vec, e_vec, iter,
      &    stress_n, stress_np1, shear_mod_vec,
      &    adaptive_possible, cut_step_size_now, signal_flag,
      &    gpn, felem, step, deps, prior_linear, trial_stress,
-     &    killed_status )
+     &    nplas, plas_list )
        implicit none
 c
 c                    parameter declarations
 c                    ----------------------
-      integer :: span, mxvl, iout, gpn, felem, step, iter
-      logical :: yield(*), debug, adaptive_possible, cut_step_size_now,
-     &           signal_flag, prior_linear(*), killed_status(span)
+      integer :: span, mxvl, iout, gpn, felem, step, iter, nplas,
+     &           plas_list(*)
+      logical :: debug, adaptive_possible, cut_step_size_now,
+     &           signal_flag, prior_linear(*)
       double precision
      & history_n(span,*), history_np1(span,*), mm_props(mxvl,10),
      & sigyld_vec(*), stress_n(mxvl,*),deps(mxvl, *),
@@ -668,7 +677,7 @@ c
 c                    local parameters
 c                    ----------------
 c
-      integer i, j, s, nsubinc, l
+      integer i, j, s, nsubinc, l, ip
       logical local_debug
       double precision
      & gamma, Q_bar, b, H_bar,
@@ -684,11 +693,9 @@ c
        data  two, one, three,  root2third
      &   /  2.0, 1.0, 3.0, 0.81649658  /
 c
-       do i = 1, span
+       do ip = 1, nplas
+         i = plas_list(ip)
          local_debug = .false.
-         if( killed_status(i) ) cycle
-c
-         if( .not. yield(i) ) cycle
 c
          g       = shear_mod_vec(i)
          aps_n   = history_n(i, 3)
@@ -1930,7 +1937,8 @@ c                       declare local variables
 c                       -----------------------
 c
        logical debug, yield(mxvl), prior_linear(mxvl)
-       integer i, j, iostat(mxvl), instat(mxvl)
+       integer i, j, iostat(mxvl), instat(mxvl), nplas,
+     &         plas_list(mxvl)
       double precision
      &     g_vec_n(mxvl), g_vec_np1(mxvl), alpha_n(mxvl, nstrn),
      &     trace_eps_np1(mxvl), zero, one, rse(6),
@@ -1961,14 +1969,17 @@ c
 c              compute stresses and internal variables at n+1
 c              ----------------------------------------------
 c
-       call mm05_gp_compute(
+       call mm05_plastic_list( span, yield, killed_status, nplas,
+     &                         plas_list )
+       if( nplas .gt. 0 )
+     &   call mm05_gp_compute(
      &   span, mxvl, debug, iout, history_np1, history_n,
-     &   mm_props, sigyld_vec_np1, sigyld_vec_n, yield,
+     &   mm_props, sigyld_vec_np1, sigyld_vec_n,
      &   iter, stress_np1, stress_n, adaptive_possible,
      &   cut_step_size_now, signal_flag, g_vec_np1, g_vec_n,
      &   h_gp_np1, h_gp_n, delta_gp_np1, delta_gp_n,
      &   beta_gp_np1, beta_gp_n, tau, gpn, felem, step, deps,
-     &   prior_linear, trial_elas_stress_np1, killed_status )
+     &   prior_linear, trial_elas_stress_np1, nplas, plas_list )
 c
        if ( cut_step_size_now ) then
           return
@@ -2361,7 +2372,7 @@ c *******************************************************************
 c *                                                                 *
 c *        material model # 5 -- adv. cyclic plasticity model       *
 c *                                                                 *
-c *        mm05_gp_compute  -- last modified 5/2/2019 rhd           *
+c *        mm05_gp_compute  -- last modified 10/19/2026 agent       *
 c *                                                                 *
 c *        currently includes:                                      *
 c *           !*automatic subincrementation revision                *
@@ -2371,20 +2382,20 @@ c *******************************************************************
 c
        subroutine mm05_gp_compute(
      &   span, mxvl, debug, iout, history_np1, history_n,
-     &   mm_props, sigyld_vec_np1, sigyld_vec_n, yield,
+     &   mm_props, sigyld_vec_np1, sigyld_vec_n,
      &   iter, stress_np1, stress_n, adaptive_possible,
      &   cut_step_size_now, signal_flag, g_vec_np1, g_vec_n,
      &   h_gp_np1, h_gp_n, delta_gp_np1, delta_gp_n,
      &   beta_gp_np1, beta_gp_n, tau, gpn, felem, step, deps,
-     &   prior_linear, trial_stress, killed_status )
+     &   prior_linear, trial_stress, nplas, plas_list )
        implicit none
 c
 c                    parameter declarations
 c                    ----------------------
-      integer :: span, mxvl, iout, gpn, felem, step, iter
-      logical :: yield(*), debug, adaptive_possible, 
-     &           cut_step_size_now, signal_flag, prior_linear(*),
-     &           killed_status(span)
+      integer :: span, mxvl, iout, gpn, felem, step, iter, nplas,
+     &           plas_list(*)
+      logical :: debug, adaptive_possible, cut_step_size_now,
+     &           signal_flag, prior_linear(*)
       double precision
      & history_n(span,*), history_np1(span,*), mm_props(mxvl,10),
      & sigyld_vec_np1(*), sigyld_vec_n(*), stress_np1(mxvl,*),
@@ -2396,7 +2407,7 @@ c
 c                    local parameters
 c                    ----------------
 c
-       integer i, j, s, nsubinc, mxsubinc, l
+       integer i, j, s, nsubinc, mxsubinc, l, ip
        logical local_debug, onestep
       double precision
      & delta_n, Hi_n, Hk_n, beta_n, g_n, k0_n, k_n,
@@ -2418,10 +2429,8 @@ c
        local_debug = .false.
 c       onestep = .false.
 c
-       do i = 1, span
-c
-          if( killed_status(i) ) cycle
-          if( .not. yield(i) ) cycle
+       do ip = 1, nplas
+          i = plas_list(ip)
 c
 c     set material vectors to scalar values and scale them from uniaxial
 c     values to 3d values
@@ -3935,6 +3944,39 @@ c
 c
        end
 
+c *******************************************************************
+c *                                                                 *
+c *        material model # 5 -- adv. cyclic plasticity model       *
+c *                                                                 *
+c *        mm05_plastic_list  -- last modified 10/19/2026 agent     *
+c *                                                                 *
+c *        compact the points in the block that yield over the      *
+c *        step into a dense index list. the return mapping then    *
+c *        runs only over the list. in most blocks most points stay *
+c *        elastic over a step                                      *
+c *                                                                 *
+c *******************************************************************
+
+      subroutine mm05_plastic_list( span, yield, killed_status,
+     &                              nplas, plas_list )
+      implicit none
+c
+      integer :: span, nplas, plas_list(*)
+      logical :: yield(*), killed_status(span)
+c
+      integer :: i
+c
+      nplas = 0
+      do i = 1, span
+        if( killed_status(i) ) cycle
+        if( .not. yield(i) ) cycle
+        nplas = nplas + 1
+        plas_list(nplas) = i
+      end do
+c
+      return
+      end
+
 c *******************************************************************
 c *                                                                 *
 c *        material model # 5 -- adv. cyclic plasticity model       *
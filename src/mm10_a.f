@@ -19,7 +19,7 @@ c     *                      subroutine mm10                         *
 c     *                                                              *
 c     *                       written by : mcm                       *
 c     *                                                              *
-c     *                   last modified: 1/10/2019 rhd               *
+c     *                   last modified: 10/19/2026 agent            *
 c     *                                                              *
 c     *              crystal plasticity stress-strain update         *
 c     *                                                              *
@@ -35,6 +35,8 @@ c
       use segmental_curves, only: max_seg_points
       use mm10_defs
       use mm10_constants
+      use crystal_data, only : data_offset, cluster_rep, cluster_wgt
+      use main_data, only : imatprp
 c
       implicit none
       include 'include_sig_up'
@@ -58,14 +60,15 @@ c
       type(crystal_props) :: cc_props
       type(crystal_state) :: cc_n, cc_np1
 c
-      integer :: i, c, now_element, iloop, number_crystals, crys_no
+      integer :: i, c, now_element, iloop, number_crystals, crys_no,
+     &           osn, check_interval
       double precision :: sig_avg(6), p_strain_ten_c(6),
      &                    p_strain_ten(6),
      &                    tang_avg(6,6), tang_avg_vec(36), ! see equiv
      &                    slip_avg(length_comm_hist(5))
       double precision :: t_work_inc, p_work_inc,p_strain_inc,
-     &                    n_avg, p_strain_avg
-      logical :: debug, locdebug, mat_debug
+     &                    n_avg, p_strain_avg, wcry
+      logical :: debug, locdebug, mat_debug, clustered, check_step
       equivalence( tang_avg, tang_avg_vec )
 c
       debug = .false.
@@ -108,10 +111,34 @@ c
 c
         number_crystals = ncrystals(i)
 c
+c              reduced-order crystal option (see mm10_cluster_crystals).
+c              only group representatives are integrated, weighted by
+c              group size, except on check steps when all crystals
+c              are integrated. groups whose slip activity diverged
+c              are split once the step has converged
+c
+        clustered  = .false.
+        check_step = .false.
+        osn        = 0
+        if( allocated( cluster_rep ) ) then
+          osn = data_offset(now_element)
+          if( osn > 0 ) clustered = cluster_rep(osn,1) > 0
+        end if
+        if( clustered ) then
+          check_interval = imatprp(135,local_work%matnum)
+          if( check_interval > 0 ) check_step =
+     &        mod( local_work%step, check_interval ) == 0
+        end if
+c
 c              loop on all crystals at integration point
 c
         do c = 1, number_crystals
           crys_no   = c  ! protect index c
+          wcry      = one
+          if( clustered .and. .not. check_step ) then
+            if( cluster_rep(osn,c) /= c ) cycle
+            wcry = dble( cluster_wgt(osn,c) )
+          end if
           debug     = local_work%debug_flag(i)
           locdebug  = .false.
           mat_debug = locdebug
@@ -132,6 +159,12 @@ c
 c          
         end do ! over crystals
 c
+c              members whose slip diverged on a check step are split
+c              after the step converges (mm10_cluster_split)
+c
+        if( clustered .and. .not. check_step )
+     &    call mm10_a_copy_cluster_hist
+c
 c              finalize averages over all crystals at point.
 c              p_strain_avg -> average effective strain increment
 c                              from the average tensor
@@ -211,12 +244,22 @@ c
       integer :: len, sh2, sh3, eh2, eh3
       double precision :: work_vec1(9), work_vec2(6), work_gradfe(27),
      &                    work_R(9), user_initial_stresses(6)
+      double precision, parameter :: ls_trial_tol_fact = 10.0d0
 c
       call mm10_init_cc_props( local_work%c_props(iloop,c),
      &              local_work%angle_type(iloop),
      &              local_work%angle_convention(iloop),
      &              local_work%debug_flag(iloop), cc_props )
       cc_props%out = iout
+c
+c              line search trial pass. the result is used only for
+c              the trial residual and is not committed. relax the
+c              relative local Newton tolerances.
+c
+      if( local_work%ls_trial ) then
+        cc_props%rtol  = ls_trial_tol_fact * cc_props%rtol
+        cc_props%rtol1 = ls_trial_tol_fact * cc_props%rtol1
+      end if
       six_plus_num_hard = 6 + cc_props%num_hard
       size_num_hard     = cc_props%num_hard
       size_nslip        = cc_props%nslip
@@ -264,15 +307,19 @@ c                    cp_strain_inc -> effective plastic increment
 c                    p_strain_ten -> plastic strain increment tensor
 c                    n_avg -> effective creep exponent
 c
-      sig_avg      = sig_avg + cc_np1%stress     ! 6x1 vector
-      tang_avg     = tang_avg + cc_np1%tangent   ! 6x6 matrix
+c                  wcry -> number of crystals represented (1 unless
+c                          reduced-order crystal groups are in use)
+c
+      sig_avg      = sig_avg + wcry*cc_np1%stress     ! 6x1 vector
+      tang_avg     = tang_avg + wcry*cc_np1%tangent   ! 6x6 matrix
       len = length_comm_hist(5)
-      slip_avg(1:len) = slip_avg(1:len) + cc_np1%slip_incs(1:len)
-      t_work_inc   = t_work_inc + cc_np1%work_inc
-      p_work_inc   = p_work_inc + cc_np1%p_work_inc
-      p_strain_inc = p_strain_inc + cc_np1%p_strain_inc
-      p_strain_ten = p_strain_ten + p_strain_ten_c
-      n_avg        = n_avg + cc_np1%p_strain_inc*cc_np1%u(12)
+      slip_avg(1:len) = slip_avg(1:len) +
+     &                  wcry*cc_np1%slip_incs(1:len)
+      t_work_inc   = t_work_inc + wcry*cc_np1%work_inc
+      p_work_inc   = p_work_inc + wcry*cc_np1%p_work_inc
+      p_strain_inc = p_strain_inc + wcry*cc_np1%p_strain_inc
+      p_strain_ten = p_strain_ten + wcry*p_strain_ten_c
+      n_avg        = n_avg + wcry*cc_np1%p_strain_inc*cc_np1%u(12)
 c
 c                  store the CP history for this crystal
 c
@@ -284,6 +331,30 @@ c
       end subroutine mm10_a_do_crystal
 c
 c              ****************************************************
+c              *  contains: mm10_a_copy_cluster_hist              *
+c              ****************************************************
+c
+      subroutine mm10_a_copy_cluster_hist
+      implicit none
+c
+c              group members carry the history of their
+c              representative
+c
+      integer :: k, r, sh, eh, shr
+c
+      do k = 1, number_crystals
+        r = cluster_rep(osn,k)
+        if( r == k ) cycle
+        sh  = index_crys_hist(k,1,1)
+        eh  = index_crys_hist(k,num_crystal_terms,2)
+        shr = index_crys_hist(r,1,1)
+        history_np1(iloop,sh:eh) = history_np1(iloop,shr:shr+eh-sh)
+      end do
+c
+      return
+      end subroutine mm10_a_copy_cluster_hist
+c
+c              ****************************************************
 c              *  contains: mm10_a_store_crystal                  *
 c              ****************************************************
 c
@@ -387,7 +458,7 @@ c
       type(crystal_props) :: cc_props
       integer :: isw, s_type1, n_hard, h_type, allocate_status
       integer :: i, c
-      logical :: process_G_H
+      logical :: process_G_H, use_table
 c
       h_type  = local_work%c_props(i, c)%h_type
       s_type1 = local_work%c_props(i, c)%s_type
@@ -401,7 +472,20 @@ c
 c
       if( (h_type .eq. 4) .or. (h_type .eq. 7) ) then
        select case( isw )
-         case( 1 ) ! allocate G,H interaction matrices
+         case( 1 ) ! point to shared G,H interaction matrices
+           use_table = .false.
+           if( s_type1 .ge. 1 .and. s_type1 .le. max_GH_types ) 
+     &       use_table = GH_tables(s_type1)%n .eq. n_hard
+           if( use_table ) then
+             cc_props%Gmat => GH_tables(s_type1)%G
+             cc_props%Hmat => GH_tables(s_type1)%H
+             cc_props%GH_shared = .true.
+             return
+           end if
+c
+c                 tables not built for this slip type. fill
+c                 private copies for the crystal
+c
            allocate( cc_props%Gmat(n_hard,n_hard),
      &               cc_props%Hmat(n_hard,n_hard),
      &               stat=allocate_status)
@@ -409,10 +493,16 @@ c
               write(*,*) ' error allocating G matrix'
               call die_gracefully
            end if
+           cc_props%GH_shared = .false.
            call mm10_mrr_GH( s_type1, n_hard, cc_props%Gmat,
      &                     cc_props%Hmat,i,c)
-         case( 2 ) ! deallocate G,H matrices
-           deallocate( cc_props%Gmat, cc_props%Hmat )
+         case( 2 ) ! release G,H matrices
+           if( cc_props%GH_shared ) then
+             nullify( cc_props%Gmat, cc_props%Hmat )
+             cc_props%GH_shared = .false.
+           else
+             deallocate( cc_props%Gmat, cc_props%Hmat )
+           end if
          case default
             write(*,*) '>>>> FATAL ERROR. invalid isw, mm10_set_cons'
             write(*,*) '                  job terminated'
@@ -865,6 +955,9 @@ c
      &                    work(3,3), work_vec(3)
       double precision, parameter :: alpha = 1.0d0/3.0d0, ! geometric hardening
      &                               twothirds = 2.0d0/3.0d0
+      double precision, parameter :: eye3(3,3) = reshape(
+     &     (/ 1.0d0, 0.0d0, 0.0d0, 0.0d0, 1.0d0, 0.0d0,
+     &        0.0d0, 0.0d0, 1.0d0 /), (/3,3/) )
 c
 c              effective strain increment
 c
@@ -886,16 +979,29 @@ c
       trans_nRp(2,3) = n%Rp(3,2)
       trans_nRp(3,3) = n%Rp(3,3)
 c
-      call mm10_RT2RVE( trans_nRp, RE ) ! makes RE(6,6)
-      call mm10_RT2RVW( trans_nRp, RW ) ! makes RW(3,3)
-      call mm10_a_mult_type_1( work, np1%R(1,1), trans_nRp )
-      call mm10_RT2RVW( work, RWC ) ! makes RWC(3,3)
+c              lattice not yet rotated (n%Rp = I, e.g. before any
+c              plastic spin): m and q are the reference tensors
+c              from the orientation setup. skip the rotations
 c
-      do i = 1, props%nslip
-        call mm10_a_mult_type_2( np1%ms(1,i), RE, props%ms(1,i) )
-        call mm10_a_mult_type_3( np1%qs(1,i), RW, props%qs(1,i) )
-        call mm10_a_mult_type_3( np1%qc(1,i), RWC, props%qs(1,i) )
-      end do
+      if( all( n%Rp == eye3 ) ) then
+        call mm10_RT2RVW( np1%R, RWC ) ! makes RWC(3,3)
+        do i = 1, props%nslip
+          np1%ms(1:6,i) = props%ms(1:6,i)
+          np1%qs(1:3,i) = props%qs(1:3,i)
+          call mm10_a_mult_type_3( np1%qc(1,i), RWC, props%qs(1,i) )
+        end do
+      else
+        call mm10_RT2RVE( trans_nRp, RE ) ! makes RE(6,6)
+        call mm10_RT2RVW( trans_nRp, RW ) ! makes RW(3,3)
+        call mm10_a_mult_type_1( work, np1%R(1,1), trans_nRp )
+        call mm10_RT2RVW( work, RWC ) ! makes RWC(3,3)
+c
+        do i = 1, props%nslip
+          call mm10_a_mult_type_2( np1%ms(1,i), RE, props%ms(1,i) )
+          call mm10_a_mult_type_3( np1%qs(1,i), RW, props%qs(1,i) )
+          call mm10_a_mult_type_3( np1%qc(1,i), RWC, props%qs(1,i) )
+        end do
+      end if
 c
 c ***** START: Add new Constitutive Models into this block *****
       select case( props%h_type )
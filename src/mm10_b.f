@@ -2472,6 +2472,37 @@ c
 c
       end subroutine
 c
+c           Forest and parallel dislocation densities for all slip
+c           systems. G and H are swept once together, column by column,
+c           in place of two separate BLAS mat-vecs. The 12x12 sets are
+c           too small for dgemv call overhead to pay off and the 48x48
+c           set streams both matrices in one pass over tt.
+      subroutine mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
+      use mm10_defs
+      use mm10_constants
+      implicit none
+c
+      type(crystal_props) :: props
+      double precision, dimension(size_num_hard) :: tt, rhoFs, rhoPs
+c
+      integer :: alpha, beta, nh
+      double precision :: ttb
+c
+      nh = props%num_hard
+      rhoFs(1:nh) = zero
+      rhoPs(1:nh) = zero
+      do beta = 1, nh
+        ttb = tt(beta)
+!DIR$ IVDEP
+        do alpha = 1, nh
+          rhoFs(alpha) = rhoFs(alpha) + props%Gmat(alpha,beta) * ttb
+          rhoPs(alpha) = rhoPs(alpha) + props%Hmat(alpha,beta) * ttb
+        end do
+      end do
+c
+      return
+      end
+c
 c           Actual mrr sliprate function
       subroutine mm10_slipinc_mrr(props, np1, n, stress, tt, 
      &                            alpha, slipinc)
@@ -2597,10 +2628,7 @@ c
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 c
 c
       do alpha = 1,props%num_hard
@@ -2923,10 +2951,7 @@ c
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 c
       do alpha = 1,props%num_hard
 
@@ -3032,10 +3057,7 @@ c
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 c
 c Compute drho_alpha/drho_beta
 c loop over numerator hardening variable
@@ -3163,10 +3185,7 @@ c
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 c        
       do alpha = 1,props%num_hard
 c        
@@ -3256,10 +3275,7 @@ c Compute the shear modulus using Roter's function
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
         
 c Compute derivative of slip rate alpha w.r.t. density beta
 c loop over slip rate
@@ -3607,10 +3623,7 @@ c              New shear modulus
 c       Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 c
 c
       do alpha = 1,props%num_hard
@@ -3929,10 +3942,7 @@ c New shear modulus
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 c
       do alpha = 1,props%num_hard
 
@@ -4040,10 +4050,7 @@ c New shear modulus
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 
 c
 c Compute drho_alpha/drho_beta
@@ -4181,10 +4188,7 @@ c New shear modulus
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
 c        
       do alpha = 1,props%num_hard
 c        
@@ -4286,10 +4290,7 @@ c New shear modulus
 c Load the interaction matrices for parallel and forest dislocs
 c        [Gmat,Hmat] = mm10_mrr_GH(props);
       ! call mm10_mrr_GH(props,Gmat,Hmat)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Gmat,props%num_hard,tt,1,zero,rhoFs,1)
-      call dgemv('N',props%num_hard,props%num_hard,one,
-     &           props%Hmat,props%num_hard,tt,1,zero,rhoPs,1)
+      call mm10_rhoFP_mrr( props, tt, rhoFs, rhoPs )
         
 c        Compute derivative of slip rate alpha w.r.t. density beta
 c        loop over slip rate
@@ -5799,8 +5799,16 @@ c
       props1%cp_099 = props%cp_099
       props1%cp_100 = props%cp_100
 
-c         constants for use in material models
-      if( allocated(props%Gmat) ) then
+c         constants for use in material models. shared
+c         interaction tables are read-only; just point to them
+      props1%GH_shared = props%GH_shared
+      if( props%GH_shared ) then
+        props1%Gmat => props%Gmat
+        props1%Hmat => props%Hmat
+        return
+      end if
+c
+      if( associated(props%Gmat) ) then
 c     Gmat: First full determine size of allocated array
       dim1 = size(props%Gmat,1)
       dim2 = size(props%Gmat,2)
@@ -5815,7 +5823,7 @@ c     Copy the contents
       call mm10_c_copy_darray(props%Gmat,sizeArr,props1%Gmat)
       end if
 
-      if( allocated(props%Hmat) ) then
+      if( associated(props%Hmat) ) then
 c     Hmat: First full determine size of allocated array
       dim1 = size(props%Hmat,1)
       dim2 = size(props%Hmat,2)
@@ -5842,8 +5850,13 @@ c
 c
       type(crystal_props) :: props1
 c
-      if( allocated(props1%Gmat) ) deallocate( props1%Gmat  )
-      if( allocated(props1%Hmat) ) deallocate( props1%Hmat )
+      if( props1%GH_shared ) then
+        nullify( props1%Gmat, props1%Hmat )
+        props1%GH_shared = .false.
+        return
+      end if
+      if( associated(props1%Gmat) ) deallocate( props1%Gmat  )
+      if( associated(props1%Hmat) ) deallocate( props1%Hmat )
 c
       return
       end
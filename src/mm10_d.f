@@ -105,11 +105,18 @@ c                  couldn't do this earlier, so check here
                 write(outdev,9502)
                 call die_gracefully
               end if
+              call mm10_orient_cache_add( i, j, k, cnum )
+              if( c_array(cnum)%h_type == 4 .or.
+     &            c_array(cnum)%h_type == 7 )
+     &          call mm10_build_GH_table( c_array(cnum)%slip_type,
+     &                                    c_array(cnum)%num_hard )
               if( cur_slip < c_array(cnum)%nslip )
      &             cur_slip = c_array(cnum)%nslip
               if( cur_hard < c_array(cnum)%num_hard )
      &             cur_hard = c_array(cnum)%num_hard
             end do ! over k, crystals
+            if( dmatprp(134,i) > 0.0d0 )
+     &        call mm10_cluster_crystals( i, j, ncrystals )
         end do ! over j ( noelem)
       end do  ! over i, materials
 c
@@ -374,6 +381,483 @@ c
      &   /,    ' Aborting.',/)
 c
       end
+c
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm10_orient_cache_add             *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *  find or create the orientation cache entry for crystal k    *
+c     *  of element elnum (material matnum). entries are shared by   *
+c     *  all elements/crystals with the same crystal number and      *
+c     *  initial angles. called only from mm10_set_history_locs      *
+c     *  (serial)                                                    *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_orient_cache_add( matnum, elnum, k, cnum )
+      use crystal_data, only : c_array, angle_input, crystal_input,
+     &     data_offset, crystal_orientation, orient_cache,
+     &     num_orient_cache, max_orient_cache, orient_index_input,
+     &     orient_index_matl, orient_hash
+      use main_data, only : imatprp, dmatprp
+      implicit none
+      include 'param_def'
+c
+      integer :: matnum, elnum, k, cnum
+c
+      integer :: osn, atype, aconv, hsize, slot, entry, nslip, m
+      integer(kind=8) :: h
+      double precision :: angles(3)
+      logical :: per_element
+c
+      hsize = 2 * max_orient_cache
+      if( .not. allocated( orient_cache ) ) then
+        allocate( orient_cache(max_orient_cache), orient_hash(hsize),
+     &            orient_index_matl(mxmat) )
+        orient_hash       = 0
+        orient_index_matl = 0
+        num_orient_cache  = 0
+      end if
+c
+      per_element = .false.
+      if( allocated( data_offset ) ) per_element =
+     &      data_offset(elnum) > 0
+      if( per_element .and. .not. allocated( orient_index_input ) ) then
+        allocate( orient_index_input(size(crystal_input,1),
+     &                               size(crystal_input,2)) )
+        orient_index_input = 0
+      end if
+c
+c              material level data already found
+c
+      if( .not. per_element ) then
+        if( orient_index_matl(matnum) > 0 ) return
+      end if
+c
+      if( imatprp(107,matnum) == 1 ) then
+        angles(1) = dmatprp(108,matnum)
+        angles(2) = dmatprp(109,matnum)
+        angles(3) = dmatprp(110,matnum)
+      else
+        osn = data_offset(elnum)
+        angles(1:3) = angle_input(osn,k,1:3)
+      end if
+      aconv = imatprp(102,matnum)
+      atype = imatprp(103,matnum)
+c
+c              hash on the key. probe linearly until we find the
+c              entry or an empty slot
+c
+      h = cnum + 64 * ( atype + 4 * aconv )
+      do m = 1, 3
+        h = ieor( ishftc( h, 17 ), transfer( angles(m), h ) )
+      end do
+      slot  = int( modulo( h, int(hsize,8) ) ) + 1
+      entry = 0
+      do
+        if( orient_hash(slot) == 0 ) exit
+        entry = orient_hash(slot)
+        if( orient_cache(entry)%cnum == cnum   .and.
+     &      orient_cache(entry)%atype == atype .and.
+     &      orient_cache(entry)%aconv == aconv .and.
+     &      all( orient_cache(entry)%angles == angles ) ) exit
+        entry = 0
+        slot  = mod( slot, hsize ) + 1
+      end do
+c
+      if( entry == 0 ) then
+        if( num_orient_cache == max_orient_cache ) return ! full
+        num_orient_cache = num_orient_cache + 1
+        entry = num_orient_cache
+        orient_hash(slot) = entry
+        nslip = c_array(cnum)%nslip
+        associate( oc => orient_cache(entry) )
+        oc%cnum   = cnum
+        oc%atype  = atype
+        oc%aconv  = aconv
+        oc%nslip  = nslip
+        oc%angles = angles
+        allocate( oc%ms(6,nslip), oc%qs(3,nslip), oc%ns(3,nslip) )
+        call mm10_orient_crystal( cnum, angles, atype, aconv,
+     &         oc%rotation_g, oc%elast_stiff, nslip, oc%ms, oc%qs,
+     &         oc%ns )
+        end associate
+      end if
+c
+      if( per_element ) then
+        orient_index_input(data_offset(elnum),k) = entry
+      else
+        orient_index_matl(matnum) = entry
+      end if
+c
+      return
+      end
+c
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm10_cluster_crystals             *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *  group the crystals of element elnum by initial orientation  *
+c     *  for the reduced-order option. greedy pass: a crystal joins  *
+c     *  the first representative of the same crystal number within *
+c     *  the misorientation tolerance (degrees), otherwise it starts *
+c     *  a new group. misorientation is the rotation angle of        *
+c     *  g_a^T g_b without crystal symmetry reduction, so groups are *
+c     *  conservative. groups already built for the element, e.g.    *
+c     *  read from a restart file, are kept                          *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_cluster_crystals( matnum, elnum, ncrystals )
+      use crystal_data, only : angle_input, crystal_input,
+     &     data_offset, cluster_rep, cluster_wgt
+      use main_data, only : imatprp, dmatprp
+      implicit none
+c
+      integer :: matnum, elnum, ncrystals
+c
+      integer :: osn, k, r, cnum_k, atype, aconv
+      double precision :: g(3,3,ncrystals), angles(3), tol_cos, c_ab
+      double precision, parameter :: one = 1.0d0, half = 0.5d0,
+     &                               pi = 3.141592653589793d0
+c
+      osn = data_offset(elnum)
+      if( osn <= 0 ) return
+      if( .not. allocated( cluster_rep ) ) then
+        allocate( cluster_rep(size(crystal_input,1),
+     &                        size(crystal_input,2)),
+     &            cluster_wgt(size(crystal_input,1),
+     &                        size(crystal_input,2)) )
+        cluster_rep = 0
+        cluster_wgt = 0
+      end if
+c
+c                 groups already built, or read from a restart file
+c                 with any splits made since. keep them
+c
+      if( cluster_rep(osn,1) > 0 ) return
+c
+      atype = imatprp(103,matnum)
+      aconv = imatprp(102,matnum)
+      tol_cos = cos( dmatprp(134,matnum) * pi / 180.0d0 )
+c
+      do k = 1, ncrystals
+        if( imatprp(107,matnum) == 1 ) then
+          angles(1) = dmatprp(108,matnum)
+          angles(2) = dmatprp(109,matnum)
+          angles(3) = dmatprp(110,matnum)
+        else
+          angles(1:3) = angle_input(osn,k,1:3)
+        end if
+        call mm10_crystal_rotation( angles, atype, aconv, g(1,1,k) )
+      end do
+c
+      do k = 1, ncrystals
+        cluster_rep(osn,k) = k
+        cluster_wgt(osn,k) = 1
+        cnum_k = mm10_cluster_cnum( k )
+        do r = 1, k-1
+          if( cluster_rep(osn,r) /= r ) cycle
+          if( mm10_cluster_cnum( r ) /= cnum_k ) cycle
+c
+c                 cos of misorientation angle = ( tr(g_r^T g_k) - 1 ) / 2
+c
+          c_ab = half * ( sum( g(:,:,r) * g(:,:,k) ) - one )
+          if( c_ab < tol_cos ) cycle
+          cluster_rep(osn,k) = r
+          cluster_wgt(osn,k) = 0
+          cluster_wgt(osn,r) = cluster_wgt(osn,r) + 1
+          exit
+        end do
+      end do
+c
+      return
+c
+      contains
+c     ========
+c
+      integer function mm10_cluster_cnum( c )
+      implicit none
+      integer :: c
+c
+      if( imatprp(104,matnum) == 2 ) then
+        mm10_cluster_cnum = crystal_input(osn,c)
+      else
+        mm10_cluster_cnum = imatprp(105,matnum)
+      end if
+c
+      return
+      end function mm10_cluster_cnum
+c
+      end subroutine mm10_cluster_crystals
+c
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm10_cluster_rebuild              *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *  discard the reduced-order crystal groups, including splits  *
+c     *  made during the solution, and group again from the initial  *
+c     *  orientations. used by reset solution                        *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_cluster_rebuild
+      use global_data  ! old common.main
+      use main_data, only : matprp, imatprp, dmatprp
+      use crystal_data, only : cluster_rep, cluster_wgt
+      implicit none
+c
+      integer :: i, j
+c
+      if( .not. allocated( cluster_rep ) ) return
+      cluster_rep = 0
+      cluster_wgt = 0
+c
+      do i = 1, nummat
+        if( matprp(9,i) /= 10 ) cycle
+        if( dmatprp(134,i) <= 0.0d0 ) cycle
+        do j = 1, noelem
+          if( iprops(38,j) /= i ) cycle
+          call mm10_cluster_crystals( i, j, imatprp(101,i) )
+        end do
+      end do
+c
+      return
+      end
+c
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm10_cluster_split                *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *  reduced-order crystal option. called by mnralg after update *
+c     *  has made the state at n+1 the converged state at n. on a    *
+c     *  check step all crystals were integrated. a group member     *
+c     *  whose slip increments at any integration point of the       *
+c     *  element differ from its representative by more than the     *
+c     *  relative tolerance becomes its own representative from now  *
+c     *  on. iterations and line search trials never split, so the   *
+c     *  groups only change with converged history                   *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_cluster_split( step )
+      use global_data, only : nelblk, elblks, myid, iprops
+      use main_data, only : matprp, imatprp, dmatprp
+      use elem_block_data, only : history_blocks, history_blk_list
+      use mm10_defs, only : index_crys_hist
+      use crystal_data, only : data_offset, cluster_rep, cluster_wgt
+      implicit none
+c
+      integer :: step
+c
+      integer :: blk, felem, span, ngp, hist_size, matnum, interval,
+     &           ncrystals, i, elem, osn, gp, c, r, sc, ec, sr, er, k
+      double precision :: split_tol, dnorm, rnorm
+      double precision, parameter :: tiny = 1.0d-30
+      logical :: split
+c
+      if( .not. allocated( cluster_rep ) ) return
+c
+      do blk = 1, nelblk
+        if( elblks(2,blk) /= myid ) cycle
+        felem  = elblks(1,blk)
+        matnum = iprops(38,felem)
+        if( matprp(9,matnum) /= 10 ) cycle
+        if( dmatprp(134,matnum) <= 0.0d0 ) cycle
+        interval = imatprp(135,matnum)
+        if( interval <= 0 ) cycle
+        if( mod( step, interval ) /= 0 ) cycle
+        span      = elblks(0,blk)
+        ngp       = iprops(6,felem)
+        hist_size = history_blk_list(blk)
+        ncrystals = imatprp(101,matnum)
+        split_tol = dmatprp(136,matnum)
+c
+c                 global history block is (hist_size,ngp,span)
+c
+        do i = 1, span
+          elem = felem + i - 1
+          osn  = data_offset(elem)
+          if( osn <= 0 ) cycle
+          if( cluster_rep(osn,1) <= 0 ) cycle
+          do c = 1, ncrystals
+            r = cluster_rep(osn,c)
+            if( r == c ) cycle
+            sc = index_crys_hist(c,6,1)
+            ec = index_crys_hist(c,6,2)
+            sr = index_crys_hist(r,6,1)
+            er = index_crys_hist(r,6,2)
+            split = .false.
+            do gp = 1, ngp
+              k = ( (i-1)*ngp + gp-1 ) * hist_size
+              dnorm = sqrt( sum( ( history_blocks(blk)%ptr(k+sc:k+ec)
+     &                - history_blocks(blk)%ptr(k+sr:k+er) )**2 ) )
+              rnorm = sqrt( sum(
+     &                  history_blocks(blk)%ptr(k+sr:k+er)**2 ) )
+              if( dnorm > split_tol*max( rnorm, tiny ) ) split = .true.
+            end do
+            if( .not. split ) cycle
+            cluster_rep(osn,c) = c
+            cluster_wgt(osn,c) = 1
+            cluster_wgt(osn,r) = cluster_wgt(osn,r) - 1
+          end do
+        end do
+      end do
+c
+      return
+      end
+c
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm10_free_orient_cache            *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_free_orient_cache
+      use crystal_data, only : orient_cache, num_orient_cache,
+     &     orient_index_input, orient_index_matl, orient_hash
+      implicit none
+c
+      if( allocated( orient_cache ) ) deallocate( orient_cache )
+      if( allocated( orient_hash ) ) deallocate( orient_hash )
+      if( allocated( orient_index_input ) )
+     &    deallocate( orient_index_input )
+      if( allocated( orient_index_matl ) )
+     &    deallocate( orient_index_matl )
+      num_orient_cache = 0
+c
+      return
+      end
+c
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm10_orient_crystal               *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *  crystal -> reference rotation, rotated elastic stiffness    *
+c     *  and rotated slip system tensors for a crystal at its        *
+c     *  initial orientation. used to build the orientation cache    *
+c     *  and by setup_mm10_rknstr for orientations not cached        *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_orient_crystal( cnum, angles, atype, aconv,
+     &                                rotation_g, elast_stiff, ldim,
+     &                                ms, qs, ns )
+      use crystal_data, only : c_array
+      implicit none
+      include 'param_def'
+c
+      integer :: cnum, atype, aconv, ldim
+      double precision :: angles(3), rotation_g(3,3), elast_stiff(6,6),
+     &                    ms(6,ldim), qs(3,ldim), ns(3,ldim)
+c
+      integer :: s, i, j
+      double precision :: trans_rot(3,3), Rstiff(6,6), temp66(6,6),
+     &                    bs(3), n(3), A(3,3), A_symm(3,3),
+     &                    A_asymm(3,3)
+      double precision, parameter :: half = 0.5d0
+c
+      call mm10_crystal_rotation( angles, atype, aconv, rotation_g )
+      trans_rot = transpose( rotation_g )
+c
+c              rotate forward the stiffness tensor
+c
+      call mm10_RT2RVE( trans_rot, Rstiff )
+      temp66 = matmul( c_array(cnum)%elast_stiff, transpose(Rstiff) )
+      elast_stiff = matmul( Rstiff, temp66 )
+c
+c              rotation on each slip system
+c
+      do s = 1, c_array(cnum)%nslip
+        bs = matmul( trans_rot, c_array(cnum)%bi(s,1:3) )
+        n  = matmul( trans_rot, c_array(cnum)%ni(s,1:3) )
+        ns(1:3,s) = n
+        do j = 1, 3
+          do i = 1, 3
+            A(i,j) = bs(i) * n(j)
+          end do
+        end do
+        A_symm  = half * ( A + transpose(A) )
+        A_asymm = half * ( A - transpose(A) )
+        call mm10_ET2EV( A_symm,  ms(1,s) )
+        call mm10_WT2WV( A_asymm, qs(1,s) )
+      end do
+c
+      return
+      end
+c
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mm10_crystal_rotation             *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *  crystal -> reference rotation from the initial angles using *
+c     *  the integer angle type & convention codes of the material   *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_crystal_rotation( angles, atype, aconv, g )
+      implicit none
+c
+      integer :: atype, aconv
+      double precision :: angles(3), g(3,3)
+c
+      integer :: out, idummy, jdummy, kdummy
+      character :: aconv_name*5, atype_name*7
+c
+      call iodevn( idummy, out, jdummy, kdummy )
+c
+      if( atype == 1 ) then
+        atype_name = "degrees"
+      elseif( atype == 2 ) then
+        atype_name = "radians"
+      else
+        write(out,9503)
+        call die_gracefully
+      end if
+      if( aconv == 1 ) then
+        aconv_name = "kocks"
+      else
+        write(out,9504)
+        call die_gracefully
+      end if
+c
+      call mm10_rotation_matrix( angles, aconv_name, atype_name, g,
+     &                           out )
+c
+      return
+ 9503 format(/,1x,'>>>> System error: unexpected angle type in',
+     &            ' mm10_crystal_rotation. Aborting.'/)
+ 9504 format(/,1x,'>>>> System error: unexpected angle conv in',
+     &            ' mm10_crystal_rotation. Aborting.'/)
+      end
 
 c     ****************************************************************
 c     *                                                              *
@@ -41,6 +41,47 @@ c
 c
 c     ****************************************************************
 c     *                                                              *
+c     *                   subroutine mm10_build_GH_table             *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified: 10/19/2026 agent            *
+c     *                                                              *
+c     *   fill the shared G & H interaction matrices for a slip      *
+c     *   system type. done once at setup so the crystal update      *
+c     *   just points at the tables rather than allocating and       *
+c     *   re-filling them for every crystal at every point           *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mm10_build_GH_table( s_type, num_hard )
+      use mm10_defs, only : GH_tables, max_GH_types
+      implicit none
+c
+      integer :: s_type, num_hard
+      integer :: alloc_stat
+c
+      if( s_type .lt. 1 .or. s_type .gt. max_GH_types ) return
+      if( GH_tables(s_type)%n .eq. num_hard ) return
+c
+      if( allocated( GH_tables(s_type)%G ) )
+     &    deallocate( GH_tables(s_type)%G, GH_tables(s_type)%H )
+      allocate( GH_tables(s_type)%G(num_hard,num_hard),
+     &          GH_tables(s_type)%H(num_hard,num_hard),
+     &          stat=alloc_stat )
+      if( alloc_stat .ne. 0 ) then
+         write(*,*) ' error allocating G,H tables'
+         call die_gracefully
+      end if
+      call mm10_mrr_GH( s_type, num_hard, GH_tables(s_type)%G,
+     &                  GH_tables(s_type)%H, 1, 1 )
+      GH_tables(s_type)%n = num_hard
+c
+      return
+      end subroutine
+c
+c     ****************************************************************
+c     *                                                              *
 c     *                   subroutine mm10_mrr_GHfcc                  *
 c     *                                                              *
 c     *                       written by : tjt                       *
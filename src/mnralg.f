@@ -4,7 +4,7 @@ c     *                      subroutine mnralg                       *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified: 12/3/2019 rhd               *
+c     *                   last modified: 10/19/2026 agent            *
 c     *                                                              *
 c     *     supervises advancing the solution from                   *
 c     *     step n to n+1 using a newton iteration process.          *
@@ -25,7 +25,15 @@ c
      &     non_zero_imposed_du, extrapolated_du, extrapolate,
      &     extrap_off_next_step, line_search, ls_details,
      &     ls_min_step_length, ls_max_step_length, ls_rho,
-     &     ls_slack_tol
+     &     ls_slack_tol, adapt_target_iters, extrap_quadratic,
+     &     du_prior, du_prior_valid, mf_nm2, arc_length,
+     &     arc_solve_load, arc_du_load, arc_target_iters, arc_radius,
+     &     arc_lambda, rload_nm1, load_pattern_factors,
+     &     total_user_nodal_forces, du_nm1, ls_cheap_trials,
+     &     ls_trial_pass, explicit_dynamics, explicit_active,
+     &     explicit_dt_fraction, explicit_dt_stable, solver_auto,
+     &     anderson_accel, anderson_depth, ifv_state_valid
+      use damage_data, only : control_load_fact
       use adaptive_steps, only : adapt_result, adapt_disp_fact,
      &                           adapt_load_fact
       use hypre_parameters, only : hyp_trigger_step
@@ -46,17 +54,22 @@ c
 c
 c           local variables
 c
-      integer :: dum, i, iout, iter, now_step
+      integer :: dum, i, iout, iter, now_step, arc_cuts
       real :: dumr
       double precision ::
      &  mgres1, magdu1, zero, one, mgload, ext_tol,
-     &  scaling_load, dumd
-      double precision, allocatable, dimension(:) ::u_n_local
+     &  scaling_load, dumd, arc_lam
+      double precision, allocatable, dimension(:) ::u_n_local,
+     &                                              du_n_local
+      integer :: aa_count, aa_next
+      double precision, allocatable :: aa_x(:), aa_f(:), aa_dx(:,:),
+     &                                 aa_df(:,:)
 c
       logical :: dynamic, material_cut_step, emit_extrap_msg,
      & emit_forced_linear_k_for_step, ls_request_adaptive,
      & diverging_flag, user_extrapolation_on, user_extrapolation_off,
-     & setup_lagrange_data
+     & setup_lagrange_data, step_start, arc_step, arc_fail,
+     & ifv_at_n, iter0_reused
 c
       character (len=1) :: dums
       logical :: local_debug, first_solve, first_subinc,
@@ -92,6 +105,13 @@ c
       now_step = step ! just for protection
       iout = out
 c
+c          ifv on entry is the converged internal force vector at n
+c          only if the last step left it so. cleared here - set again
+c          at the bottom once this step converges.
+c
+      ifv_at_n        = ifv_state_valid
+      ifv_state_valid = .false.
+c
 c          store model displacement vector at start of step (n).
 c          "u" will be updated to n+1 in this routine.
 c          at bottom here we set du = u(n+1) - u(n) to get
@@ -102,6 +122,17 @@ c
       allocate( u_n_local(nodof) )
       u_n_local(1:nodof) = u(1:nodof)
 c
+c          quadratic extrapolation: du on entry (converged n-1 -> n)
+c          becomes du_prior for the next step. step_start marks the
+c          first increment of the step - the only one started from
+c          u(n) with du = converged increment of the prior step.
+c
+      if( extrap_quadratic ) then
+        allocate( du_n_local(nodof) )
+        du_n_local(1:nodof) = du(1:nodof)
+      end if
+      step_start = .true.
+c
 c          used to track how the step converged for updating
 c          global onvergence_history info
 c
@@ -136,6 +167,39 @@ c
       call adapt_check( scaling_adapt, 3, step, out )
       dt_original  = dt
 c
+c          solution technique auto. pick direct or iterative
+c          Pardiso for this step from the solve times measured in
+c          prior steps.
+c
+      if( solver_auto ) call mnralg_auto_solver
+c
+c          arc-length control of the load factor for this step (if
+c          requested and the model/solver allow it). arc-length cuts
+c          replace the adaptive subdivision for the step.
+c
+      arc_step = .false.
+      if( arc_length ) call mnralg_arc_setup
+      if( arc_step ) adaptive = .false.
+c
+c          explicit central difference dynamics for this step (if
+c          requested and dt is within the stable limit). no
+c          iterations - adaptive does not apply.
+c
+      explicit_active = .false.
+      if( explicit_dynamics ) call mnralg_explicit_setup
+      if( explicit_active ) adaptive = .false.
+c
+c          predictive step control (user set a target number of
+c          iterations). the step may start already subdivided based
+c          on how the prior step converged. extrapolation stays on -
+c          scaling_adapt carries the smaller increment.
+c
+      if( adaptive .and. adapt_target_iters .gt. 0 .and.
+     &    .not. arc_step ) then
+        call adapt_check( scaling_adapt, 4, step, out )
+        if( adapt_result .eq. 2 ) info%adaptive_used = .true.
+      end if
+c
 c           calculate the scaling value for extrapolated displacements.
 c           this value is used for real steps only (not subincrements).
 c           the scaling value is modified if the step is subincremented.
@@ -199,6 +263,10 @@ c
          call chkcrack( step, 0 )
          call growth_loads
       end if
+      if( explicit_active ) then
+        call mnralg_explicit_step
+        go to 100
+      end if
       if( show_details ) write(out,9150) step
 c
 c          set up the displacement increment to start the step or
@@ -280,7 +348,11 @@ c
                 if( show_details ) write(out,9153) scaling_factor
              end if
              extrapolated_du = .true.
-             du(1:nodof) =  scaling_factor * du(1:nodof)
+             if( extrap_quadratic .and. step_start ) then
+               call mnralg_extrap_quadratic
+             else
+               du(1:nodof) =  scaling_factor * du(1:nodof)
+             end if
              if( local_debug ) write (iout,9530) scaling_factor
            end if
         else ! no extrapolation to start this step.
@@ -288,6 +360,15 @@ c
            if( show_details ) write(out,9154) step
         end if
       end if
+      step_start = .false.
+c
+c          arc-length steps start from du = 0 with the tangent [D]
+c          at n. the load factor then comes from the arc constraint.
+c
+      if( arc_step ) then
+        du(1:nodof) = zero
+        extrapolated_du = step .gt. 1
+      end if
 c
 c          apply constraints to the starting displacement change for
 c          step. non-zero constraints are scaled by current adaptive
@@ -346,10 +427,14 @@ c          the step (either extrapolate or non-zero constraints). this is
 c          a simple way to get the "applied" forces equivalent to the
 c          imposed, incremental displacements for step.
 c
-      if( show_details ) write(out,9155) step
       material_cut_step = .false.
-      call drive_eps_sig_internal_forces( step, 0,
+      call mnralg_iter0_reuse( iter0_reused )
+      if( .not. iter0_reused ) then
+        if( show_details ) write(out,9155) step
+        call drive_eps_sig_internal_forces( step, 0,
      &          material_cut_step )
+      end if
+      ifv_at_n = .false.
 c
 c          element stiffness matrices. (stifup gets only new element
 c          stiffnesss - not a structure stiff).
@@ -390,6 +475,7 @@ c          1 of step.
 c
       call uppbar( pbar, mdiag, a, v, load, dload, nbeta, dt,
      &             adapt_load_fact, nodof, out )
+      if( arc_step ) call mnralg_arc_start
       call upres_iter_0( mgres1, nbeta, dt, nodof, out, cstmap,
      &                   pbar, ifv, mdiag, du, res, dstmap )
 c
@@ -406,9 +492,10 @@ c          and imposed displacement increments = 0. We should
 c          let solution continue here so that "fake" v. small loads
 c          are not needed in such creep solutions.
 c
-      if( mgres1.eq.zero .and. zrocon ) then
+      if( mgres1.eq.zero .and. zrocon .and. .not. arc_step ) then
          call errmsg(230,step,dums,dumr,dumd)
          iter = 0
+         ifv_at_n = .true.
          go to 100
       endif
 c
@@ -491,9 +578,12 @@ c          Enforce MPCs when:
 c              - symmetric MKL solvers (direct/iterative)
 c              - no MPI
 c
+      arc_solve_load = arc_step
+      if( arc_step ) arc_du_load(1:nodof) = zero
       call eqn_solve( iter, step, first_solve,
      &                nodof, solver_flag, use_mpi, show_details,
      &                du, idu, iout )
+      arc_solve_load = .false.
 c
 c          This applies only to hypre:  If we return from the solver
 c          and hypre has indicated that it needs an adaptive step
@@ -509,10 +599,22 @@ c
                go to 1000
       end if
 c
+c          Anderson acceleration of the correction idu from the
+c          history of corrections in this step. the line search
+c          then works along the accelerated direction. not for
+c          arc-length steps - the arc constraint sets the correction.
+c
+      if( anderson_accel .and. .not. arc_step ) call mnralg_anderson
+c
 c          run strain-stress-internal force update. include line
 c          search in this process if option in on.
 c          an "instrumented" line search is available for research
 c          work on algortihms
+c
+      if( arc_step ) then
+        call mnralg_arc_correct
+        if( arc_fail ) go to 50
+      end if
 c
 c      call mnralg_ls_instrumented
       call mnralg_ls
@@ -522,7 +624,7 @@ c          strains (e.g. inverted element) or a material stress
 c          update process faile ? then use adaptive immediately.
 c
       if(  material_cut_step ) then ! from a material model across all ranks
-       if( adaptive  ) then
+       if( adaptive .or. arc_step ) then
          if( show_details ) write(out,9420)
          go to 50
        else
@@ -564,6 +666,15 @@ c          converge.
 c
       if( show_details ) write(out,9410) step
  50   continue
+      if( arc_step ) then
+          call mnralg_arc_cut
+          if( .not. arc_fail ) then
+               call adaptive_reset
+               first_subinc = .true.
+               go to 1000  ! do over with smaller arc length
+          end if
+          call abort_job
+      end if
       if( adaptive ) then
           info%adaptive_used = .true.
           call adapt_check( scaling_adapt, 1, step, out )
@@ -586,7 +697,11 @@ c          for solution state needed to support adaptive
 c          restart of the step.
 c
  100  continue
+      ifv_at_n = ( ifv_at_n .or. ( cnverg .and. iter .gt. 0 ) )
+     &           .and. .not. explicit_active
+      if( arc_step ) call mnralg_arc_finish
       call update
+      call mm10_cluster_split( step )
       call adaptive_save
 c
 c          reset time step to original size
@@ -667,6 +782,22 @@ c          will not be this if adaptive was used over n -> n+1
 c
       du(1:nodof) = u(1:nodof) - u_n_local(1:nodof)
       deallocate( u_n_local )
+c
+c          keep the increment for n-1 -> n for quadratic
+c          extrapolation at the next step. only a converged,
+c          proportional sequence of steps qualifies.
+c
+      if( allocated( du_n_local ) ) then
+        if( .not. allocated( du_prior ) ) allocate( du_prior(nodof) )
+        du_prior(1:nodof) = du_n_local(1:nodof)
+        mf_nm2            = mf_nm1
+        du_prior_valid    = cnverg .and. step .gt. 1 .and.
+     &                      .not. mf_ratio_change .and. .not. arc_step
+        deallocate( du_n_local )
+      else
+        du_prior_valid = .false.
+      end if
+      ifv_state_valid = ifv_at_n
 c
       return  ! back to stpdrv
 c
@@ -730,7 +861,7 @@ c     *                     subroutine mnralg_ls                     *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 12/3/2015 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *    run line search for this global Newton iteration if       *
 c     *    user requested . instrumented version to gather behavior  *
@@ -750,7 +881,8 @@ c
      &      ls_reduce_fraction, alpha_values(30)
       double precision, allocatable :: du0(:)
 
-      logical :: ls_debug, no_line_search, line_search_details
+      logical :: ls_debug, no_line_search, line_search_details,
+     &           cheap_trial
       integer :: ls_ell
       character(len=1) :: ls_flag
       data zero, one / 0.0d00, 1.0d00 /
@@ -758,10 +890,11 @@ c
       if( show_details ) write(iout,9210) step, iter
 c
       ls_debug = .false.
+      cheap_trial = .false.
       line_search_details = ls_details
       if( ls_debug ) write(iout,8900) step, iter
       rho = ls_rho
-      no_line_search = .not. line_search
+      no_line_search = .not. line_search .or. arc_step
       slack_toler = ls_slack_tol
       alpha_min = ls_min_step_length
       ls_request_adaptive = .false.
@@ -806,9 +939,15 @@ c
 c
 c              2a. new alpha (step length). get s-value.
 c                   material routines may want immediate adaptive.
+c                   with ls_cheap_trials, lengths after the first
+c                   are trial passes (no commit of n+1 state,
+c                   relaxed local tolerances in mm10).
 c
          if( ls_debug ) write(iout,8910) ls_ell, alpha
+         cheap_trial = ls_cheap_trials .and. ls_ell > 1
+         ls_trial_pass = cheap_trial
          call mnralg_ls_update_res( alpha, du0 )
+         ls_trial_pass = .false.
          if( material_cut_step ) then
            deallocate( du0 )
            return
@@ -830,6 +969,7 @@ c
      &                                    alpha, r_value
              if( show_details ) write(iout,9200) alpha, ls_flag,
      &                                           step, iter
+             if( cheap_trial ) call mnralg_ls_update_res( alpha, du0 )
              deallocate( du0 )
              return
          end if
@@ -1136,6 +1276,766 @@ c
       end if
       return
       end subroutine mnralg_ls_get_s
+c     ****************************************************************
+c     *                                                              *
+c     *                   subroutine mnralg_anderson                 *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *    Anderson mixing of the Newton correction idu with the     *
+c     *    last anderson_depth iterates of the step                  *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mnralg_anderson
+      implicit none
+c
+      integer :: m, i, j, k, col, ncol
+      double precision :: g(10,10), b(10), gam(10), s_raw, s_acc,
+     &                    w, gmax
+      double precision, parameter :: reg_fact = 1.0d-10
+c
+c          the Newton iteration is the fixed point map
+c          x -> x + f(x) with x = du at the start of the iteration
+c          and f = idu. the differences dx_j, df_j of the last ncol
+c          iterates give gamma = argmin || f - [df] gamma || (normal
+c          equations, lightly regularized, Cholesky) and the mixed
+c          correction f - [dx + df] gamma. with a fresh tangent this
+c          changes little; with a stale or approximate tangent
+c          (linear convergence) it recovers most of the Newton rate.
+c
+c          the history restarts at iteration 1 of every step or
+c          adaptive sub-increment. absolute constraints keep the
+c          solver values. a mixed correction that is not a descent
+c          direction for the residual (line search s-value) is
+c          dropped in favor of idu and the history restarts. not
+c          used with MPCs/tied contact - the Lagrange forces belong
+c          to the solver correction.
+c
+      if( setup_lagrange_data ) return
+      m = anderson_depth
+c
+      if( iter .eq. 1 .or. .not. allocated( aa_x ) ) then
+        if( .not. allocated( aa_x ) ) allocate( aa_x(nodof),
+     &      aa_f(nodof), aa_dx(nodof,m), aa_df(nodof,m) )
+        aa_count = 0
+        aa_next  = 1
+        do i = 1, nodof
+          aa_x(i) = du(i)
+          aa_f(i) = zero
+          if( cstmap(i) .eq. 0 ) aa_f(i) = idu(i)
+        end do
+        return
+      end if
+c
+      col = aa_next
+!DIR$ IVDEP
+      do i = 1, nodof
+        w = zero
+        if( cstmap(i) .eq. 0 ) w = idu(i)
+        aa_dx(i,col) = du(i) - aa_x(i)
+        aa_df(i,col) = w - aa_f(i)
+        if( cstmap(i) .ne. 0 ) aa_dx(i,col) = zero
+        aa_x(i) = du(i)
+        aa_f(i) = w
+      end do
+      aa_count = min( aa_count + 1, m )
+      aa_next  = mod( col, m ) + 1
+      ncol     = aa_count
+c
+      gmax = zero
+      do j = 1, ncol
+        b(j) = dot_product( aa_df(1:nodof,j), aa_f(1:nodof) )
+        do k = 1, j
+          g(j,k) = dot_product( aa_df(1:nodof,j), aa_df(1:nodof,k) )
+          g(k,j) = g(j,k)
+        end do
+        gmax = max( gmax, g(j,j) )
+      end do
+      if( gmax .le. zero ) return
+      do j = 1, ncol
+        g(j,j) = g(j,j) + reg_fact * gmax
+      end do
+c
+c          Cholesky factor (lower) and solve. a zero pivot means
+c          the history is degenerate - restart it.
+c
+      do j = 1, ncol
+        w = g(j,j) - dot_product( g(j,1:j-1), g(j,1:j-1) )
+        if( w .le. zero ) then
+          aa_count = 0
+          aa_next  = 1
+          return
+        end if
+        g(j,j) = sqrt( w )
+        do k = j+1, ncol
+          g(k,j) = ( g(k,j) - dot_product( g(k,1:j-1), g(j,1:j-1) ) )
+     &             / g(j,j)
+        end do
+      end do
+      do j = 1, ncol
+        gam(j) = ( b(j) - dot_product( g(j,1:j-1), gam(1:j-1) ) )
+     &           / g(j,j)
+      end do
+      do j = ncol, 1, -1
+        gam(j) = ( gam(j) - dot_product( g(j+1:ncol,j),
+     &             gam(j+1:ncol) ) ) / g(j,j)
+      end do
+c
+      call mnralg_ls_get_s( s_raw )
+      do j = 1, ncol
+!DIR$ IVDEP
+        do i = 1, nodof
+          if( cstmap(i) .ne. 0 ) cycle
+          idu(i) = idu(i) - gam(j) * ( aa_dx(i,j) + aa_df(i,j) )
+        end do
+      end do
+      call mnralg_ls_get_s( s_acc )
+c
+      if( s_acc .ge. zero .and. s_raw .lt. zero ) then
+        do i = 1, nodof
+          if( cstmap(i) .eq. 0 ) idu(i) = aa_f(i)
+        end do
+        aa_count = 0
+        aa_next  = 1
+        if( show_details ) write(out,9010) step, iter
+        return
+      end if
+      if( show_details ) write(out,9000) ncol, step, iter
+c
+      return
+c
+ 9000 format(7x,
+     & '>> anderson acceleration. depth used: ',i2,12x,i7,i3)
+ 9010 format(7x,
+     & '>> anderson correction not a descent direction.',
+     & ' history reset',i7,i3)
+c
+      end subroutine mnralg_anderson
+c     ****************************************************************
+c     *                                                              *
+c     *                subroutine mnralg_extrap_quadratic            *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *    starting du for the step from the two prior converged     *
+c     *    increments (quadratic in load factor). falls back to the  *
+c     *    linear s*du when the history is not trustworthy           *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mnralg_extrap_quadratic
+      implicit none
+c
+      integer :: i
+      logical :: use_quad
+      double precision :: s, q, c, corr, dot, norm_n, norm_nm1,
+     &                    norm_corr
+      double precision, parameter :: q_min = 0.2d0, q_max = 5.0d0,
+     &                    cos_min = 0.95d0, corr_max = 0.5d0
+c
+c          du   = u(n) - u(n-1),   load factor change mf_nm1
+c          du_prior = u(n-1) - u(n-2), load factor change mf_nm2
+c          s    = mf / mf_nm1,     q = mf_nm2 / mf_nm1
+c
+c          second-order Lagrange fit through the three converged
+c          states evaluated at the new load factor gives
+c
+c             du_new = s*du + s*(s+1)/(q+1) * ( du - du_prior/q )
+c
+c          the correction term is the curvature of the path. it is
+c          rejected (-> linear) for non-proportional or strongly
+c          unequal steps, a path that turned sharply between the
+c          two prior steps, or a correction larger than half of the
+c          linear prediction - those signal a limit point, unloading
+c          or a change of mechanism that a quadratic cannot follow.
+c
+      s = scaling_factor
+      use_quad = du_prior_valid .and. allocated( du_prior ) .and.
+     &           s .gt. zero .and. abs( mf_nm2 ) .gt. ext_tol
+      if( use_quad ) then
+        q = mf_nm2 / mf_nm1
+        use_quad = q .ge. q_min .and. q .le. q_max
+      end if
+c
+      if( use_quad ) then
+        dot      = zero
+        norm_n   = zero
+        norm_nm1 = zero
+        do i = 1, nodof
+          dot      = dot + du(i) * du_prior(i)
+          norm_n   = norm_n + du(i) * du(i)
+          norm_nm1 = norm_nm1 + du_prior(i) * du_prior(i)
+        end do
+        use_quad = norm_n .gt. zero .and. norm_nm1 .gt. zero
+        if( use_quad ) use_quad =
+     &         dot .ge. cos_min * sqrt( norm_n * norm_nm1 )
+      end if
+c
+      if( use_quad ) then
+        c = s * ( s + one ) / ( q + one )
+        norm_corr = zero
+        do i = 1, nodof
+          corr = c * ( du(i) - du_prior(i) / q )
+          norm_corr = norm_corr + corr * corr
+        end do
+        use_quad = norm_corr .le. ( corr_max * s )**2 * norm_n
+      end if
+c
+      if( .not. use_quad ) then
+        du(1:nodof) = s * du(1:nodof)
+        if( show_details .and. du_prior_valid ) write(out,9000) step
+        return
+      end if
+c
+!DIR$ IVDEP
+      do i = 1, nodof
+        du(i) = s * du(i) + c * ( du(i) - du_prior(i) / q )
+      end do
+      if( show_details ) write(out,9010) step
+c
+      return
+c
+ 9000 format(1x,'>> quadratic extrapolation rejected for step: ',i7,
+     &       '. using linear')
+ 9010 format(1x,'>> quadratic extrapolation of displacements for',
+     &       ' step: ',i7)
+c
+      end subroutine mnralg_extrap_quadratic
+c     ****************************************************************
+c     *                                                              *
+c     *  subroutines: mnralg_arc_setup, mnralg_arc_start,            *
+c     *               mnralg_arc_correct, mnralg_arc_cut,            *
+c     *               mnralg_arc_finish                              *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *    cylindrical arc-length (Crisfield) control of the load    *
+c     *    factor over a static step. the step load increment       *
+c     *    (dload) fixes the load direction. lambda = 1 is the user  *
+c     *    step, lambda < 1 or > 1 (or < 0 past a limit point) is    *
+c     *    whatever the arc constraint ||du|| = arc_radius gives     *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mnralg_arc_setup
+      implicit none
+c
+      integer :: j
+      double precision :: sum
+      character(len=40) :: why
+c
+c          the 2nd solve (load vector) is coded for direct,
+c          symmetric pardiso w/o mpcs (the load rhs would need the
+c          mpc transformation). temperature, imposed displacement
+c          and user_routine load increments are not proportional
+c          to the load factor. these steps run the usual Newton.
+c
+      why = ' '
+      if( dynamic ) why = 'dynamic analysis'
+      if( solver_flag .ne. 7 .or. solver_mkl_iterative .or.
+     &    asymmetric_assembly ) why = 'needs direct, symmetric pardiso'
+      if( mpcs_exist .or. tied_con_mpcs_constructed )
+     &    why = 'mpcs or tied contact'
+      if( temperatures ) why = 'temperature increments'
+      if( allocated( total_user_nodal_forces ) )
+     &    why = 'user_routine loads'
+      if( why .eq. ' ' ) then
+        do j = 1, nodof
+          if( cstmap(j) .eq. 0 ) cycle
+          if( cnstrn(j) .ne. zero ) why = 'imposed displacements'
+        end do
+      end if
+      if( why .eq. ' ' ) then
+        sum = zero
+        do j = 1, nodof
+          if( cstmap(j) .eq. 0 ) sum = sum + dload(j) * dload(j)
+        end do
+        if( sum .eq. zero ) why = 'no load increment'
+      end if
+c
+      if( why .ne. ' ' ) then
+        write(out,9000) step, trim( why )
+        return
+      end if
+c
+      arc_step = .true.
+      arc_cuts = 0
+      arc_lam  = zero
+      if( .not. allocated( arc_du_load ) )
+     &    allocate( arc_du_load(nodof) )
+c
+c          adaptive_reset (arc-length cuts) restores du from du_nm1.
+c          step 1 has no prior increment yet.
+c
+      if( .not. allocated( du_nm1 ) ) then
+        allocate( du_nm1(nodof) )
+        du_nm1(1:nodof) = zero
+      end if
+c
+      return
+c
+ 9000 format(7x,'>> arc-length not used for step: ',i7,' (',a,
+     &       '). Newton on the step load')
+c
+      end subroutine mnralg_arc_setup
+c
+      subroutine mnralg_arc_start
+      implicit none
+c
+c          pbar from uppbar has the full step increment. start the
+c          step (and each retry) at lambda = 0 - loads at n.
+c
+      pbar(1:nodof) = pbar(1:nodof) - adapt_load_fact * dload(1:nodof)
+      arc_lam = zero
+c
+      return
+      end subroutine mnralg_arc_start
+c
+      subroutine mnralg_arc_correct
+      implicit none
+c
+      integer :: j
+      double precision :: qq, qw, ww, uq, a2, a3, disc, root1, root2,
+     &                    dlam, w
+      double precision, parameter :: two = 2.0d0, four = 4.0d0
+c
+c          idu = [K]^-1 res and arc_du_load = [K]^-1 dload from the
+c          same factorization. the correction is idu + dlam *
+c          arc_du_load with dlam from ||du + correction|| = radius.
+c
+c          iteration 1: predictor dlam = +- radius / ||du_load||.
+c          sign from the converged increment of the prior step
+c          (positive work along the path). the first arc-length
+c          step without a user radius takes lambda = 1 to set it.
+c
+c          later iterations: roots of the quadratic. the root that
+c          keeps du pointing forward (larger du . du_new) is used.
+c          complex roots => cut the arc length.
+c
+      arc_fail = .false.
+      qq = zero
+      do j = 1, nodof
+        qq = qq + arc_du_load(j) * arc_du_load(j)
+      end do
+      if( qq .le. zero ) then
+        arc_fail = .true.
+        write(out,9010) step, iter
+        return
+      end if
+c
+      if( iter .eq. 1 ) then
+        if( arc_radius .le. zero ) arc_radius = sqrt( qq )
+        dlam = arc_radius / sqrt( qq )
+        if( step .gt. 1 .and. allocated( du_nm1 ) ) then
+          uq = zero
+          do j = 1, nodof
+            uq = uq + du_nm1(j) * arc_du_load(j)
+          end do
+          if( uq .lt. zero ) dlam = -dlam
+        end if
+      else
+        qw = zero
+        ww = zero
+        uq = zero
+        do j = 1, nodof
+          w  = du(j) + idu(j)
+          qw = qw + arc_du_load(j) * w
+          ww = ww + w * w
+          uq = uq + du(j) * arc_du_load(j)
+        end do
+        a2   = two * qw
+        a3   = ww - arc_radius * arc_radius
+        disc = a2 * a2 - four * qq * a3
+        if( disc .lt. zero ) then
+          arc_fail = .true.
+          if( show_details ) write(out,9020) step, iter
+          return
+        end if
+        root1 = ( -a2 + sqrt( disc ) ) / ( two * qq )
+        root2 = ( -a2 - sqrt( disc ) ) / ( two * qq )
+        dlam = root1
+        if( uq .lt. zero ) dlam = root2
+      end if
+c
+!DIR$ IVDEP
+      do j = 1, nodof
+        idu(j)  = idu(j) + dlam * arc_du_load(j)
+        pbar(j) = pbar(j) + dlam * dload(j)
+      end do
+      arc_lam = arc_lam + dlam
+      if( show_details ) write(out,9000) iter, dlam, arc_lam
+c
+      return
+c
+ 9000 format(7x,
+     & '>> arc-length iteration, d-lambda, lambda:         ',i3,
+     & 2e12.4)
+ 9010 format(7x,'>> arc-length: zero load solution. step, iter: ',
+     &       i7,i3)
+ 9020 format(7x,'>> arc-length: no intersection with the arc.',
+     &       ' step, iter: ',i7,i3)
+c
+      end subroutine mnralg_arc_correct
+c
+      subroutine mnralg_arc_cut
+      implicit none
+c
+      integer, parameter :: max_cuts = 8
+      double precision, parameter :: half = 0.5d0
+c
+      arc_cuts = arc_cuts + 1
+      arc_fail = arc_cuts .gt. max_cuts
+      if( arc_fail ) then
+        write(out,9010) step, max_cuts
+        return
+      end if
+      arc_radius = half * arc_radius
+      write(out,9000) step, arc_radius
+c
+      return
+c
+ 9000 format(/,7x,'>> arc-length step: ',i7,' restarted with',
+     &       ' arc length: ',e12.4)
+ 9010 format(/,1x,'>> arc-length step: ',i7,' not converged after ',
+     &       i2,' arc length cuts')
+c
+      end subroutine mnralg_arc_cut
+c
+      subroutine mnralg_arc_finish
+      implicit none
+c
+      integer :: j
+      double precision :: dlam, fac
+      double precision, parameter :: two = 2.0d0, quarter = 0.25d0
+c
+c          the step applied arc_lam * dload. make the load vectors
+c          and accumulated pattern multipliers match that so the
+c          next step (eqivld, modify_load) continues from the
+c          loads actually on the model.
+c
+      dlam = arc_lam - one
+      do j = 1, nodof
+        if( cstmap(j) .eq. 0 ) load(j) = load(j) + dlam * dload(j)
+        rload_nm1(j) = rload_nm1(j) + dlam * dload(j)
+        dload(j)     = arc_lam * dload(j)
+      end do
+      do j = 1, numlod
+        load_pattern_factors(j,1) = load_pattern_factors(j,1) +
+     &        dlam * control_load_fact * load_pattern_factors(j,2)
+      end do
+      arc_lambda = arc_lam
+      write(out,9000) step, arc_lam, arc_radius
+c
+c          arc length for the next step from the iterations here
+c          vs. the target (Crisfield). limit the change to 1/4 - 2.
+c
+      if( cnverg ) then
+        fac = sqrt( dble( arc_target_iters ) / dble( max( iter, 1 ) ) )
+        arc_radius = arc_radius * min( two, max( quarter, fac ) )
+      end if
+c
+      return
+c
+ 9000 format(7x,'>> arc-length step: ',i7,' load factor: ',f10.5,
+     &       ' arc length: ',e12.4)
+c
+      end subroutine mnralg_arc_finish
+c
+      subroutine mnralg_explicit_setup
+      implicit none
+c
+      integer :: elem_min
+      character(len=40) :: why
+c
+c          central difference needs a lumped mass on every free dof
+c          and no constraint equations (the Lagrange forces come
+c          from the solver). the root does the update - no MPI.
+c          the stable time step estimate is made on the first
+c          explicit step (and after a restart). a user dt above the
+c          stable limit runs the usual implicit Newmark step.
+c
+      why = ' '
+      if( .not. dynamic ) why = 'not a dynamic analysis'
+      if( use_mpi ) why = 'MPI execution'
+      if( mpcs_exist .or. tied_con_mpcs_constructed )
+     &    why = 'mpcs or tied contact'
+      if( why .ne. ' ' ) then
+        write(out,9000) step, trim( why )
+        return
+      end if
+c
+      if( explicit_dt_stable .le. zero ) then
+        call cmpmas_stable_dt( explicit_dt_stable, elem_min )
+        write(out,9010) explicit_dt_stable, elem_min,
+     &                  explicit_dt_fraction
+      end if
+      if( explicit_dt_stable .le. zero ) then
+        write(out,9000) step, 'no stable time step estimate'
+        return
+      end if
+      if( dt .gt. explicit_dt_fraction * explicit_dt_stable ) then
+        write(out,9020) step, dt,
+     &                  explicit_dt_fraction * explicit_dt_stable
+        return
+      end if
+c
+      explicit_active = .true.
+c
+      return
+c
+ 9000 format(7x,'>> explicit dynamics not used for step: ',i7,' (',a,
+     &       '). implicit newmark step')
+ 9010 format(7x,'>> explicit dynamics. stable time step estimate: ',
+     &       e12.4,' (element: ',i8,'). fraction used: ',f6.3)
+ 9020 format(7x,'>> explicit dynamics not used for step: ',i7,
+     &  /,7x,'   time step: ',e12.4,' > stable limit: ',e12.4,
+     &  '. implicit newmark step')
+c
+      end subroutine mnralg_explicit_setup
+c
+      subroutine mnralg_auto_solver
+      implicit none
+c
+      integer :: mode, other, new_mode
+      logical :: cg_failed
+      integer, parameter :: probe_steps = 20
+      double precision, parameter :: switch_fact = 0.9d0
+      character(len=9), parameter :: names(2) =
+     &                                (/ 'direct   ', 'iterative' /)
+c
+c          mode 1 = direct, 2 = iterative (CGS preconditioned with
+c          the most recent factorization - Pardiso refactors on its
+c          own when CGS does not converge). the wall time per solve
+c          for the option used in the last step becomes its current
+c          average. the other option is probed for one step when
+c          it has never run or its average is older than
+c          probe_steps. otherwise switch when the other option is
+c          at least 10% faster per solve. a CGS failure (nearly
+c          singular or ill-conditioned [K]) sends the solution back
+c          to direct and the iterative option waits for the next
+c          probe. arc-length and out-of-core need direct.
+c
+      mode = 1
+      if( solver_mkl_iterative ) mode = 2
+      other = 3 - mode
+c
+      if( auto_nsolve(mode) .gt. 0 ) then
+        auto_avg_solve(mode) = auto_tsolve(mode) /
+     &                         dble( auto_nsolve(mode) )
+        auto_avg_step(mode) = step - 1
+      end if
+      cg_failed = mode .eq. 2 .and. auto_cg_fails .gt. 0
+      if( cg_failed ) auto_avg_solve(2) = huge( one )
+      auto_nsolve   = 0
+      auto_tsolve   = zero
+      auto_cg_fails = 0
+c
+      new_mode = mode
+      if( arc_length .or. solver_out_of_core .or. cg_failed ) then
+        new_mode = 1
+      else if( step .gt. 1 ) then
+        if( auto_avg_solve(other) .le. zero .or.
+     &      step - auto_avg_step(other) .gt. probe_steps ) then
+          new_mode = other
+        else if( auto_avg_solve(other) .lt.
+     &           switch_fact * auto_avg_solve(mode) ) then
+          new_mode = other
+        end if
+      end if
+c
+      if( new_mode .eq. mode ) return
+      solver_mkl_iterative = new_mode .eq. 2
+      write(out,9000) step, trim( names(mode) ),
+     &                trim( names(new_mode) ), auto_avg_solve(1:2)
+      if( cg_failed ) write(out,9010)
+c
+      return
+c
+ 9000 format(7x,'>> solution technique auto. step: ',i7,1x,a,' -> ',a,
+     &  /,7x,'   wall time per solve. direct: ',e10.3,
+     &  '  iterative: ',e10.3,' (0 => not yet measured)')
+ 9010 format(7x,'   iterative solver (CGS) failed to converge in ',
+     &  'the last step')
+c
+      end subroutine mnralg_auto_solver
+c
+      subroutine mnralg_explicit_step
+      use contact, only : contact_force
+      implicit none
+c
+      integer :: j
+      double precision :: half_dt, a_n1, v_n1, fext
+      double precision, parameter :: half = 0.5d0
+c
+c          one central difference update n -> n+1 (newmark with
+c          beta = 0, gamma = 1/2). no element stiffnesses, no
+c          assembly, no solve:
+c
+c            du      = dt * v_n + dt**2/2 * a_n   (free dof)
+c            f_int   = from the stress update with du
+c            a_n1    = ( p_n1 + contact - f_int ) / m   (lumped)
+c            v_n1    = v_n + dt/2 * ( a_n + a_n1 )
+c
+c          dof with imposed displacements take du = cnstrn. their
+c          velocity/acceleration follow from du (average velocity
+c          over the step). zero-mass free dof get a_n1 = 0.
+c          update (called at label 100) uses v, a as set here.
+c
+      half_dt = half * dt
+      non_zero_imposed_du = .false.
+      extrapolated_du     = .false.
+      do j = 1, nodof
+        if( cstmap(j) .ne. 0 ) then
+          du(j) = cnstrn(j)
+        else
+          du(j) = dt * ( v(j) + half_dt * a(j) )
+        end if
+      end do
+c
+      iter = 1
+      call wmpi_send_step
+      call wmpi_send_itern
+      if( temperatures ) call mnralg_scale_temps( 2, iout )
+      call contact_find
+      material_cut_step = .false.
+      call drive_eps_sig_internal_forces( step, iter,
+     &                                    material_cut_step )
+      if( material_cut_step ) then
+        write(out,9000) step
+        call abort_job
+      end if
+c
+      do j = 1, nodof
+        if( cstmap(j) .ne. 0 ) then
+          v_n1   = du(j) / half_dt - v(j)
+          a(j)   = ( v_n1 - v(j) ) / dt
+          v(j)   = v_n1
+          res(j) = zero
+          cycle
+        end if
+        fext = load(j) + contact_force(j)
+        a_n1 = zero
+        if( mdiag(j) .gt. zero ) a_n1 = ( fext - ifv(j) ) / mdiag(j)
+        v(j)   = v(j) + half_dt * ( a(j) + a_n1 )
+        a(j)   = a_n1
+        res(j) = fext - ifv(j) - mdiag(j) * a_n1
+      end do
+c
+      cnverg = .true.
+      if( show_details ) write(out,9010) step, dt
+c
+      return
+c
+ 9000 format(/,2x,'>>> material model stress update computations',
+     &  ' failed in explicit step: ',i7,
+     &  /,2x,'    (no adaptive step reduction for explicit dynamics)')
+ 9010 format(7x,'>> explicit central difference step: ',i7,
+     &       '  dt: ',e12.4)
+c
+      end subroutine mnralg_explicit_step
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine mnralg_iter0_reuse                *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *    skip the iteration 0 strain-stress-ifv pass when it can   *
+c     *    only reproduce the converged state at n                   *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine mnralg_iter0_reuse( reuse )
+      use elem_block_data, only : cep_blocks, cep_blk_list
+      use main_data, only : nonlocal_analysis, initial_state_option,
+     &                      fgm_node_values_defined
+      use damage_data, only : growth_by_kill, growth_by_release
+      implicit none
+c
+      logical :: reuse
+c
+      integer :: blk, felem, span, ngp, mat_type, i, k, j, elem
+      double precision :: e, nu, c1, c2, c3, c4
+      double precision, parameter :: two = 2.0d0
+c
+c          with du = 0 over the step, no temperature increments and
+c          the converged ifv of step n still in place, the pass at
+c          iteration 0 returns the stresses and ifv already held.
+c          the one product still needed is the linear-elastic [D]
+c          that mm01/mm03 store at iteration 0 for the iteration 1
+c          stiffness. build it here from props(7), props(8). only
+c          solid blocks of those two models with constant (not
+c          temperature dependent, not fgm) properties qualify.
+c          mpi ranks would need the same decision - not supported.
+c
+      reuse = .false.
+      if( .not. ifv_at_n ) return
+      if( extrapolated_du .or. non_zero_imposed_du ) return
+      if( temperatures .or. use_mpi ) return
+      if( arc_step .or. explicit_active ) return
+      if( nonlocal_analysis .or. initial_state_option ) return
+      if( growth_by_kill .or. growth_by_release ) return
+      if( fgm_node_values_defined ) return
+      do i = 1, nodof
+        if( du(i) .ne. zero ) return
+      end do
+c
+      do blk = 1, nelblk
+        felem    = elblks(1,blk)
+        mat_type = iprops(25,felem)
+        if( mat_type .ne. 1 .and. mat_type .ne. 3 ) return
+        if( iand( iprops(24,felem), 4 ) .ne. 0 ) return
+        if( cep_blk_list(blk) .ne. 21 ) return
+      end do
+c
+      do blk = 1, nelblk
+        felem = elblks(1,blk)
+        span  = elblks(0,blk)
+        ngp   = iprops(6,felem)
+        call cep_blk_expand( blk )
+        k = 0
+        do j = 1, ngp
+          do i = 1, span
+            elem = felem + i - 1
+            e  = props(7,elem)
+            nu = props(8,elem)
+            c1 = e / ( (one+nu)*(one-two*nu) )
+            c2 = (one-nu)*c1
+            c3 = ((one-two*nu)/two)*c1
+            c4 = nu*c1
+            cep_blocks(blk)%vector(k+1:k+21) = zero
+            cep_blocks(blk)%vector(k+1)  = c2
+            cep_blocks(blk)%vector(k+2)  = c4
+            cep_blocks(blk)%vector(k+3)  = c2
+            cep_blocks(blk)%vector(k+4)  = c4
+            cep_blocks(blk)%vector(k+5)  = c4
+            cep_blocks(blk)%vector(k+6)  = c2
+            cep_blocks(blk)%vector(k+10) = c3
+            cep_blocks(blk)%vector(k+15) = c3
+            cep_blocks(blk)%vector(k+21) = c3
+            k = k + 21
+          end do
+        end do
+        call cep_blk_compact( blk )
+      end do
+c
+      reuse = .true.
+      if( show_details ) write(out,9000) step
+c
+      return
+c
+ 9000 format(7x,
+     & '>> iteration 0 pass skipped. ifv of step n reused: ',i7)
+c
+      end subroutine mnralg_iter0_reuse
 c
       end subroutine mnralg
 
@@ -56,9 +56,26 @@ c
      &        h_type, miter, gpp, s_type, cnum, method,
      &        st_it(3), num_hard, tang_calc, out
         logical :: solver, strategy, debug, gpall, alter_mode
-        ! constants for use in material models
-        double precision, dimension(:,:), allocatable :: Gmat,Hmat
+        ! constants for use in material models. G,H point into
+        ! the shared GH_tables (GH_shared = .true.) or are
+        ! allocated for the crystal
+        double precision, dimension(:,:), pointer, contiguous ::
+     &                     Gmat => null(), Hmat => null()
+        logical :: GH_shared = .false.
       end type
+c
+c              interaction matrices G & H for the dislocation density
+c              hardening models (h_type 4, 7) depend only on the slip
+c              system type. built once by mm10_set_history_locs for
+c              each slip type in use. read-only during threaded
+c              processing of element blocks.
+c
+      integer, parameter :: max_GH_types = 10
+      type :: GH_table
+        integer :: n = 0
+        double precision, dimension(:,:), allocatable :: G, H
+      end type
+      type(GH_table), target :: GH_tables(max_GH_types)
 c
       type :: crystal_state
         double precision, dimension(3,3) :: R, Rp
@@ -232,6 +249,43 @@ c           Data structures for mm11 Monte Carlo angles
             double precision :: cry_multiplier
             logical :: defined_crystal, srequired
             integer :: nangles
+c
+c           Orientation cache. crystal -> reference rotation, rotated
+c           elastic stiffness and rotated slip tensors for each
+c           unique (crystal number, initial angles, angle type,
+c           angle convention). These depend only on input data so
+c           are built once by mm10_set_history_locs and are read-only
+c           during threaded processing of element blocks.
+c           orient_index_input(osn,c) (element data from files) and
+c           orient_index_matl(matnum) map to entries. 0 => not
+c           cached (cache full); setup computes the values directly.
+c
+            type :: crystal_orientation
+              integer :: cnum, atype, aconv, nslip
+              double precision :: angles(3), rotation_g(3,3),
+     &                            elast_stiff(6,6)
+              double precision, allocatable :: ms(:,:), qs(:,:),
+     &                                         ns(:,:)
+            end type
+            integer, parameter :: max_orient_cache = 5000
+            type(crystal_orientation), allocatable :: orient_cache(:)
+            integer :: num_orient_cache = 0
+            integer, allocatable :: orient_index_input(:,:),
+     &                              orient_index_matl(:),
+     &                              orient_hash(:)
+c
+c           Reduced-order crystal clustering (optional, per material).
+c           crystals at a point with nearby initial orientations are
+c           grouped; only the representative of each group is
+c           integrated and carries the group size as its weight in
+c           the point averages. cluster_rep(osn,c) = representative
+c           of crystal c (= c for representatives), cluster_wgt(osn,c)
+c           = group size for representatives. Built by
+c           mm10_set_history_locs for elements with crystal data
+c           from files. Groups split during threaded block processing
+c           only touch rows of elements in the block.
+c
+            integer, allocatable :: cluster_rep(:,:), cluster_wgt(:,:)
 
       contains
 c                 Initializes crystal num with defaults
@@ -2327,7 +2381,8 @@ c     ****************************************************************
 c
       subroutine cleanup_crystal
       use crystal_data, only : angle_input, crystal_input,
-     &            data_offset, simple_angles, mc_array
+     &            data_offset, simple_angles, mc_array, cluster_rep,
+     &            cluster_wgt
       use global_data ! old common.main
       implicit integer (a-z)
 c
@@ -2336,6 +2391,9 @@ c
       if (allocated(data_offset)) deallocate(data_offset)
       if (allocated(simple_angles)) deallocate(simple_angles)
       if (allocated(mc_array)) deallocate(mc_array)
+      call mm10_free_orient_cache
+      if (allocated(cluster_rep)) deallocate(cluster_rep)
+      if (allocated(cluster_wgt)) deallocate(cluster_wgt)
 
       call wmpi_dealloc_crystals
 
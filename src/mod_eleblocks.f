@@ -5,7 +5,7 @@ c     *                     elem_block_data                          *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 9/15/2019 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     define the data structures for element data stored       *
 c     *     in blocks                                                *
@@ -41,6 +41,17 @@ c
         type :: array_blocks_ptr_type
           double precision, dimension(:,:), pointer :: ptr
         end type
+c
+c                single precision storage of blocks. see
+c                estiff_single_prec, cep_single_prec in main_data
+c
+        type :: blocks_sp_allocatable_type
+          real, dimension(:), allocatable :: vector
+        end type
+c
+        type :: array_blocks_sp_ptr_type
+          real, dimension(:,:), pointer :: ptr
+        end type
 c
         type :: int_blocks_ptr_type
               integer, dimension(:,:), pointer :: ptr
@@ -101,6 +112,14 @@ c
      &         allocatable :: cep_blocks
         integer, dimension (:), allocatable, save :: cep_blk_list
 c
+c               single precision [D]s. a block lives here between
+c               uses. cep_blk_expand makes the double precision
+c               copy in cep_blocks while the block is processed,
+c               cep_blk_compact puts it back.
+c
+        type (blocks_sp_allocatable_type), save, dimension(:),
+     &         allocatable :: cep_blocks_sp
+c
 c               number of gauss points for elements in blocks
 c               ---------------------------------------------
 c
@@ -124,12 +143,40 @@ c
         type (array_blocks_ptr_type), save, dimension(:),
      &         allocatable :: estiff_blocks
 c
+c               single precision element stiffnesses. same
+c               expand/compact scheme as cep_blocks_sp. assembly
+c               reads these directly
+c
+        type (array_blocks_sp_ptr_type), save, dimension(:),
+     &         allocatable :: estiff_blocks_sp
+c
+c               .true. for blocks whose stored element stiffnesses
+c               were computed for a linear-elastic, small-strain
+c               response and can be re-used (see do_nlek_block)
+c
+        logical, dimension (:), allocatable, save :: estiff_blk_frozen
+c               interface-cohesive rotations bigR (span x 3 x 3) for
+c               small-displacement blocks. built on first use by
+c               cohes_rot_mat_blk and kept for the analysis
+c               -------------------------------------------------
+        type (blocks_allocatable_type), save, dimension(:),
+     &         allocatable :: cohes_rot_blocks
+        logical, dimension (:), allocatable, save :: cohes_rot_built
+c
 c               element internal forces
 c               -----------------------
 c
         type (array_blocks_ptr_type), save, dimension(:),
      &         allocatable :: einfvec_blocks
 c
+c               node -> (element, local node) table to gather
+c               element internal forces onto nodes. built on first
+c               use by addifv_gather_setup. entries for node n are
+c               ifv_gather_ptr(n) : ifv_gather_ptr(n+1)-1
+c
+        integer, dimension (:), allocatable, save :: ifv_gather_ptr,
+     &            ifv_gather_elem, ifv_gather_lnode
+c
 c               solid-interface connections for nonlocal
 c               ----------------------------------------
 c
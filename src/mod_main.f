@@ -141,7 +141,7 @@ c     *                     module main_data                         *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *              last modified : 6/28/2018 rhd                   *
+c     *              last modified : 10/19/2026 agent                *
 c     *                                                              *
 c     *     define the data structures for main, large arrays        *
 c     *     used in warp3d solutions. also other variables as we     *
@@ -409,8 +409,44 @@ c
       type (ulist), dimension(100) :: user_lists ! 100 is set in param_def
 c
 c               UMAT model used ? Force serialization of umats?
+c               Force per point umat calls when umat_batch exists?
 c
-      logical :: umat_serial, umat_used
+      logical :: umat_serial, umat_used, umat_per_point
+c
+c               per-thread scratch for span-batched umats
+c               (words, threads). sized from umat_set_features
+c               before the threaded block loop. not in restart
+c
+      double precision, allocatable :: umat_batch_scratch(:,:)
+c
+c               assemble the internal force vector by a node-centric
+c               gather rather than the threaded element scatter.
+c               results do not depend on the number of threads
+c
+      logical :: deterministic_ifv
+c
+c               keep element stiffness blocks and/or the [D] blocks
+c               in single precision between uses. all arithmetic on
+c               them stays double precision
+c
+      logical :: estiff_single_prec, cep_single_prec
+c
+c               integration point coordinates, weights, shape
+c               functions and parametric derivatives for each
+c               (element type, integration order) pair. built once
+c               on first use in gp_shape_lookup (getgpts.f) then
+c               only copied by the block stiffness/strain/force
+c               routines. not saved in restart files
+c
+      type :: gp_shape_table
+        integer :: ngp, nnode
+        double precision, allocatable, dimension(:) :: xi, eta,
+     &                                                 zeta, weights
+        double precision, allocatable, dimension(:,:) :: shape, nxi,
+     &                                                   neta, nzeta
+      end type
+      type(gp_shape_table), save :: gp_shape_tables(19,9)
+      logical, save :: gp_shape_tables_built(19,9) = .false.
 c
 c
 c               creep material appears in solution. will force
@@ -429,6 +465,12 @@ c
       end type
       type( step_convergence_data ), dimension(5) ::
      &   convergence_history
+c
+c                 target number of newton iterations per increment
+c                 for the predictive step controller (adapt_check).
+c                 0 = off: adaptive only reacts to failed increments
+c
+      integer :: adapt_target_iters
       logical :: run_user_solution_routine
 c
 c                 A CP flag, stick here b/c it's a solution parameter
@@ -461,13 +503,87 @@ c                 step only
       logical :: extrapolated_du, non_zero_imposed_du,
      &           extrapolate, extrap_off_next_step
 c
-c                 line search parameters
-c
-      logical :: line_search, ls_details
+c                 ifv (and sum_ifv, energies) hold the internal forces
+c                 of the converged state n from the last mnralg call.
+c                 lets the next step skip the iteration 0 element
+c                 pass when its starting du is zero. not saved in
+c                 restart
+c
+      logical :: ifv_state_valid
+c
+c                 a reset solution command has been processed. the
+c                 element properties from the first case are kept, so
+c                 material input is rejected from then on. not saved
+c                 in restart
+c
+      logical :: solution_was_reset
+c
+c                 quadratic extrapolation over the last 3 converged
+c                 steps (extrap_quadratic). du_prior is the converged
+c                 increment for the step before the last one, with
+c                 load factor mf_nm2. du_prior_valid is .true. only
+c                 when that increment is from a proportional sequence.
+c                 not saved for restart - first step after a restart
+c                 uses linear extrapolation
+c
+      logical :: extrap_quadratic, du_prior_valid
+      double precision :: mf_nm2
+      double precision, allocatable :: du_prior(:)
+c
+c                 arc-length (cylindrical) control of the load factor
+c                 over a step. arc_radius is the current arc length
+c                 (norm of du), 0 => set by the next arc-length step.
+c                 arc_lambda is the factor on the user step increment
+c                 reached by the last converged arc-length step.
+c                 arc_solve_load asks the equation solver for a 2nd
+c                 solve, [K] * arc_du_load = dload, with the factored
+c                 tangent.
+c
+      logical :: arc_length, arc_solve_load
+      integer :: arc_target_iters
+      double precision :: arc_radius, arc_lambda
+c
+c                 explicit (central difference) dynamics. one explicit
+c                 update per load (time) step with the lumped mass
+c                 mdiag. explicit_dt_stable is the critical time step
+c                 estimated from element lengths and dilatational wave
+c                 speeds (0 => not yet computed, recomputed after a
+c                 restart). dt must be <= explicit_dt_fraction *
+c                 explicit_dt_stable. explicit_active is set by mnralg
+c                 for a step run explicitly - update skips newmark.
+c
+      logical :: explicit_dynamics, explicit_active
+      double precision :: explicit_dt_fraction, explicit_dt_stable
+      double precision, allocatable :: arc_du_load(:)
+c
+c                 solution technique auto. solver_flag is 7 (Pardiso)
+c                 and mnralg sets solver_mkl_iterative at the start
+c                 of each step from the measured wall time per solve
+c                 of the direct and iterative (CGS preconditioned by
+c                 the last factorization) options. see
+c                 mnralg_auto_solver and performance_data.
+c
+      logical :: solver_auto
+c
+c                 line search parameters. with ls_cheap_trials, step
+c                 lengths after the first are evaluated with
+c                 ls_trial_pass set: stress/force pass that does not
+c                 commit the n+1 state. the accepted length gets a
+c                 full pass.
+c
+      logical :: line_search, ls_details, ls_cheap_trials,
+     &           ls_trial_pass
       double precision ::
      & ls_min_step_length, ls_max_step_length, ls_rho,
      & ls_slack_tol
 c
+c                 Anderson acceleration (mixing) of the Newton
+c                 corrections idu over the last anderson_depth
+c                 iterations of a step. see mnralg_anderson.
+c
+      logical :: anderson_accel
+      integer :: anderson_depth
+c
 c                 does model have crystal plasticity materials.
 c                 no need to savein restart file
 c                 see init.f
@@ -493,6 +609,17 @@ c                 support for global forcing solver rebuild
 c
       logical :: force_solver_rebuild
 c
+c                 restart file format. store writes a leading record
+c                 (restart_format_key, restart_format_version). files
+c                 from before the format carried a version have no
+c                 such record and read as version 0. reopen sets
+c                 restart_file_version to the version of the file
+c                 being read. see store for the version history.
+c
+      integer, parameter :: restart_format_key = -2147483647,
+     &                      restart_format_version = 2
+      integer :: restart_file_version
+c
 c                 hollerith constants so current compilers
 c                 stop complaining about stms such as
 c
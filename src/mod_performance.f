@@ -4,7 +4,7 @@ c     *                      module performance_data                 *
 c     *                                                              *          
 c     *                       written by : mcm                       *          
 c     *                                                              *          
-c     *                   last modified : 04/27/2017 rhd             *          
+c     *                   last modified : 10/19/2026 agent           *          
 c     *                                                              *          
 c     *                      stores various profiling data           *          
 c     *                                                              *          
@@ -20,6 +20,18 @@ c
 c                                                                               
       real, save, private :: time_pardiso, time_warp,                           
      &                       start_run_pardiso                                  
+c
+c                 solution technique auto. wall time and number of
+c                 Pardiso solves in the current step for 1=direct,
+c                 2=iterative, the per-solve averages from the last
+c                 step run with each option, the step in which that
+c                 average was measured, and the number of iterative
+c                 solves in the current step where CGS failed and
+c                 Pardiso refactored (iparm(20) < 0).
+c
+      integer, save :: auto_nsolve(2), auto_avg_step(2),
+     &                 auto_cg_fails
+      double precision, save :: auto_tsolve(2), auto_avg_solve(2)
 c                                                                               
       contains                                                                  
 c                                                                               
@@ -46,6 +58,7 @@ c
 c                                                                               
         time_pardiso = 0.0                                                      
         time_warp = 0.0                                                         
+        call t_auto_solver_init
 c                                                                               
         return                                                                  
         end subroutine                                                          
@@ -86,6 +99,31 @@ c
 c                                                                               
         return                                                                  
         end subroutine                                                          
+c
+        subroutine t_auto_solver_init
+        implicit none
+c
+        auto_nsolve    = 0
+        auto_avg_step  = 0
+        auto_cg_fails  = 0
+        auto_tsolve    = 0.0d0
+        auto_avg_solve = 0.0d0
+c
+        return
+        end subroutine
+c
+        subroutine t_auto_solver_record( mode, tsolve, cg_iters )
+        implicit none
+        integer :: mode, cg_iters
+        double precision :: tsolve
+c
+        auto_nsolve(mode) = auto_nsolve(mode) + 1
+        auto_tsolve(mode) = auto_tsolve(mode) + tsolve
+        if( mode .eq. 2 .and. cg_iters .lt. 0 )
+     &     auto_cg_fails = auto_cg_fails + 1
+c
+        return
+        end subroutine
                                                                                 
                                                                                 
                                                                                 
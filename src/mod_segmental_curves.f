@@ -67,6 +67,24 @@ c
       logical ::                                                                
      &  seg_curve_def(max_seg_curves)                                           
 c                                                                               
+c          piecewise-linear lookup table for each temperature or
+c          rate dependent curve set. built once on first use by
+c          set_up_segmental (setup_mat_props.f), then shared read-only
+c          by all threads. rows are the curves in the set (ascending
+c          dependency value x). cols 1-7 are e, nu, alpha, gp_sigma_0,
+c          gp_h_u, gp_beta_u, gp_delta_u; cols 8 -> 7+num points are
+c          the curve stresses. slope(k,:) spans x(k) -> x(k+1), last
+c          row zero. not saved in restart files - rebuilt on demand.
+c          redefining a curve set (inmat) clears its built flag.
+c
+      integer, parameter :: seg_lookup_num_props = 7
+      type :: seg_curve_lookup
+        integer :: num_curves, num_cols
+        double precision, allocatable :: x(:), y(:,:), slope(:,:)
+      end type
+      type(seg_curve_lookup), save :: seg_lookup(max_seg_curve_sets)
+      logical, save :: seg_lookup_built(max_seg_curve_sets) = .false.
+c
 c          These variable below are used during problem                         
 c          solution to support block-by-block computations.                     
 c          The module is used to reduced the large number                       
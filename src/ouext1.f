@@ -206,7 +206,7 @@ c     *                      subroutine oupri1                       *
 c     *                                                              *          
 c     *                       written by : bh                        *          
 c     *                                                              *          
-c     *                   last modified : 07/04/91                   *          
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *          
 c     *     this subroutine computes the principal cauchy stresses   *          
 c     *     or almansi strains and the direction cosines of their    *          
@@ -217,54 +217,40 @@ c     *                                                              *
 c     ****************************************************************          
 c                                                                               
 c                                                                               
-      subroutine oupri1( span, str, prstr, angles, stress )                     
-      implicit integer (a-z)                                                    
-      include 'param_def'                                                       
-      double precision                                                          
-     &     str(mxvl,*), prstr(mxvl,*), angles(mxvl,ndim,*)                      
-      logical stress                                                            
-c                                                                               
-c                    locally allocated                                          
-c                                                                               
-      double precision                                                          
-     &     tstr(nstr,mxvl), wk(ndim,mxvl), ev(nstr,mxvl),                       
-     &     evec(ndim,ndim,mxvl), factor, one, half                              
-      data one, half / 1.0, 0.5 /                                               
-c                                                                               
-      factor = one                                                              
-      if ( .not. stress ) factor = half                                         
-      do i = 1, span                                                            
-         tstr(1,i) = str(i,1)                                                   
-         tstr(2,i) = str(i,4) * factor                                          
-         tstr(3,i) = str(i,2)                                                   
-         tstr(4,i) = str(i,6) * factor                                          
-         tstr(5,i) = str(i,5) * factor                                          
-         tstr(6,i) = str(i,3)                                                   
-      end do                                                                    
-c                                                                               
-      do i = 1, span                                                            
-         call ou3dpr( tstr(1,i), ndim, 1, ev(1,i), evec(1,1,i),                 
-     &                ndim, wk(1,i), ier )                                      
-      end do                                                                    
-c                                                                               
-c                                                                               
-      do i = 1, span                                                            
-         prstr(i,1)    = ev(1,i)                                                
-         prstr(i,2)    = ev(2,i)                                                
-         prstr(i,3)    = ev(3,i)                                                
-         angles(i,1,1) = evec(1,1,i)                                            
-         angles(i,1,2) = evec(1,2,i)                                            
-         angles(i,1,3) = evec(1,3,i)                                            
-         angles(i,2,1) = evec(2,1,i)                                            
-         angles(i,2,2) = evec(2,2,i)                                            
-         angles(i,2,3) = evec(2,3,i)                                            
-         angles(i,3,1) = evec(3,1,i)                                            
-         angles(i,3,2) = evec(3,2,i)                                            
-         angles(i,3,3) = evec(3,3,i)                                            
-      end do                                                                    
-c                                                                               
-c                                                                               
-      return                                                                    
-      end                                                                       
+      subroutine oupri1( span, str, prstr, angles, stress )
+      implicit none
+      include 'param_def'
+c
+      integer :: span
+      double precision :: str(mxvl,*), prstr(mxvl,*),
+     &                    angles(mxvl,ndim,*)
+      logical :: stress
+c
+c                    locally allocated
+c
+      integer :: i
+      double precision :: c(mxvl,nstr), factor
+      double precision, parameter :: one = 1.0d0, half = 0.5d0
+c
+c                    symmetric storage mode (11,12,22,13,23,33) then
+c                    closed-form values, vectors for the span.
+c                    angles(i,:,j) is vector j as before.
+c
+      factor = one
+      if( .not. stress ) factor = half
+!DIR$ IVDEP
+      do i = 1, span
+         c(i,1) = str(i,1)
+         c(i,2) = str(i,4) * factor
+         c(i,3) = str(i,2)
+         c(i,4) = str(i,6) * factor
+         c(i,5) = str(i,5) * factor
+         c(i,6) = str(i,3)
+      end do
+c
+      call evcmp1_vectors( span, mxvl, c, prstr, angles )
+c
+      return
+      end
                                                                                 
                                                                                 
@@ -121,63 +121,39 @@ c
                                                                                 
                                                                                 
                                                                                 
-c     ****************************************************************          
-c     *                                                              *          
-c     *                      subroutine princ_strain                 *          
-c     *                                                              *          
-c     *                       written by : kck                       *          
-c     *                                                              *          
-c     *                   last modified : 10/04/94                   *          
-c     *                                   03/05/95 kck               *          
-c     *                                   06/10/97 rhd               *          
-c     *                                                              *          
-c     *     this subroutine computes principal strain values         *          
-c     *     at the nodes/elem after the primary values have          *          
-c     *     been averaged                                            *          
-c     *                                                              *          
-c     ****************************************************************          
-c                                                                               
-      subroutine princ_strain( results, nrowd, numele )                            
-      implicit integer (a-z)                                                    
-      include 'param_def'                                                       
-      double precision :: results(nrowd,*)                                                     
-c                                                                               
-c                    locally allocated                                          
-c                                                                               
-      double precision                                                          
-     &  temp_strain(nstr), wk(ndim), ev(nstr), evec(ndim,ndim), half            
-c                                                                               
-      data  half / 0.5d0 /                                                        
-c                                                                               
-c                                                                               
-c        calculate the principal strains and there direction cosines by         
-c        passing off strains into dummy array, then calling an eigenvalue       
-c        eigenvector routine, and then passing the values from this routine     
-c        back to the appropriate places within results                          
-c                                                                               
-       do i = 1, numele                                                           
-          temp_strain(1) = results(i,1)                                         
-          temp_strain(2) = results(i,4) * half                                  
-          temp_strain(3) = results(i,2)                                         
-          temp_strain(4) = results(i,6) * half                                  
-          temp_strain(5) = results(i,5) * half                                  
-          temp_strain(6) = results(i,3)                                         
-          call ou3dpr( temp_strain, ndim, 1, ev, evec, ndim, wk, ier )          
-          results(i,11) = ev(1)                                                 
-          results(i,12) = ev(2)                                                 
-          results(i,13) = ev(3)                                                 
-          results(i,14) = evec(1,1)                                             
-          results(i,15) = evec(2,1)                                             
-          results(i,16) = evec(3,1)                                             
-          results(i,17) = evec(1,2)                                             
-          results(i,18) = evec(2,2)                                             
-          results(i,19) = evec(3,2)                                             
-          results(i,20) = evec(1,3)                                             
-          results(i,21) = evec(2,3)                                             
-          results(i,22) = evec(3,3)                                             
-      end do                                                                    
-      return                                                                    
-      end                                                                       
+c     ****************************************************************
+c     *                                                              *
+c     *                      subroutine princ_strain                 *
+c     *                                                              *
+c     *                       written by : kck                       *
+c     *                                                              *
+c     *                   last modified : 10/04/94                   *
+c     *                                   03/05/95 kck               *
+c     *                                   06/10/97 rhd               *
+c     *                                   10/19/2026 agent           *
+c     *                                                              *
+c     *     this subroutine computes principal strain values         *
+c     *     at the nodes/elem after the primary values have          *
+c     *     been averaged                                            *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine princ_strain( results, nrowd, numele )
+      implicit none
+c
+      integer :: nrowd, numele
+      double precision :: results(nrowd,*)
+c
+      double precision, parameter :: half = 0.5d0
+c
+c        calculate the principal strains and their direction cosines.
+c        tensor shear terms in symmetric storage mode then the
+c        closed-form solver for blocks of mxvl rows.
+c
+      call princ_values_vectors( results, nrowd, numele, half, 11 )
+c
+      return
+      end
                                                                                 
                                                                                 
                                                                                 
@@ -187,61 +163,97 @@ c
                                                                                 
                                                                                 
                                                                                 
-c     ****************************************************************          
-c     *                                                              *          
-c     *                      subroutine princ_stress                 *          
-c     *                                                              *          
-c     *                       written by : kck                       *          
-c     *                                                              *          
-c     *                   last modified : 10/04/94                   *          
-c     *                                   03/05/95 kck               *          
-c     *                                   06/10/97 rhd               *          
-c     *                                                              *          
-c     *     this subroutine computes principal stress values         *          
-c     *     at the nodes/elem after the primary values have          *          
-c     *     been averaged                                            *          
-c     *                                                              *          
-c     ****************************************************************          
-c                                                                               
-      subroutine princ_stress( results, nrowd, numele )                            
-      implicit integer (a-z)                                                    
-      include 'param_def'                                                       
-      double precision :: results(nrowd,*)                                                     
-c                                                                               
-c                    locally allocated                                          
-c                                                                               
-      double precision  ::                                                        
-     &  temp_stress(nstr), wk(ndim), ev(nstr), evec(ndim,ndim)                  
-c                                                                               
-c                                                                               
-c        calculate the principal stresses and there direction cosines by        
-c        passing off stresses into dummy array, then calling an eigenvalue      
-c        eigenvector routine, and then passing the values from this routine     
-c        back to the appropriate places within results                          
-c                                                                               
-       do i = 1, numele                                                            
-          temp_stress(1) = results(i,1)                                         
-          temp_stress(2) = results(i,4)                                         
-          temp_stress(3) = results(i,2)                                         
-          temp_stress(4) = results(i,6)                                         
-          temp_stress(5) = results(i,5)                                         
-          temp_stress(6) = results(i,3)                                         
-          call ou3dpr( temp_stress, ndim, 1, ev, evec, ndim, wk, ier )          
-          results(i,15) = ev(1)                                                 
-          results(i,16) = ev(2)                                                 
-          results(i,17) = ev(3)                                                 
-          results(i,18) = evec(1,1)                                             
-          results(i,19) = evec(2,1)                                             
-          results(i,20) = evec(3,1)                                             
-          results(i,21) = evec(1,2)                                             
-          results(i,22) = evec(2,2)                                             
-          results(i,23) = evec(3,2)                                             
-          results(i,24) = evec(1,3)                                             
-          results(i,25) = evec(2,3)                                             
-          results(i,26) = evec(3,3)                                             
-      end do                                                                    
-      return                                                                    
-      end                                                                       
+c     ****************************************************************
+c     *                                                              *
+c     *                      subroutine princ_stress                 *
+c     *                                                              *
+c     *                       written by : kck                       *
+c     *                                                              *
+c     *                   last modified : 10/04/94                   *
+c     *                                   03/05/95 kck               *
+c     *                                   06/10/97 rhd               *
+c     *                                   10/19/2026 agent           *
+c     *                                                              *
+c     *     this subroutine computes principal stress values         *
+c     *     at the nodes/elem after the primary values have          *
+c     *     been averaged                                            *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine princ_stress( results, nrowd, numele )
+      implicit none
+c
+      integer :: nrowd, numele
+      double precision :: results(nrowd,*)
+c
+      double precision, parameter :: one = 1.0d0
+c
+      call princ_values_vectors( results, nrowd, numele, one, 15 )
+c
+      return
+      end
+c     ****************************************************************
+c     *                                                              *
+c     *                  subroutine princ_values_vectors             *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     principal values and direction cosines for rows of       *
+c     *     results. values go into cols first_col -> +2 then the    *
+c     *     3 vectors into the next 9 cols. mxvl rows at a time      *
+c     *     through the closed-form solver evcmp1_vectors            *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine princ_values_vectors( results, nrowd, numele,
+     &                                 shear_factor, first_col )
+      implicit none
+      include 'param_def'
+c
+      integer :: nrowd, numele, first_col
+      double precision :: results(nrowd,*), shear_factor
+c
+      integer :: i, j, k, n, span, col
+      double precision :: c(mxvl,6), ev(mxvl,3), evec(mxvl,3,3)
+c
+      do i = 1, numele, mxvl
+        span = min( mxvl, numele - i + 1 )
+!DIR$ IVDEP
+        do k = 1, span
+          n = i + k - 1
+          c(k,1) = results(n,1)
+          c(k,2) = results(n,4) * shear_factor
+          c(k,3) = results(n,2)
+          c(k,4) = results(n,6) * shear_factor
+          c(k,5) = results(n,5) * shear_factor
+          c(k,6) = results(n,3)
+        end do
+c
+        call evcmp1_vectors( span, mxvl, c, ev, evec )
+c
+        col = first_col
+        do j = 1, 3
+!DIR$ IVDEP
+          do k = 1, span
+            results(i+k-1,col+j-1) = ev(k,j)
+          end do
+        end do
+        col = first_col + 3
+        do j = 1, 3      ! vector
+          do n = 1, 3    ! component
+!DIR$ IVDEP
+            do k = 1, span
+              results(i+k-1,col) = evec(k,n,j)
+            end do
+            col = col + 1
+          end do
+        end do
+      end do
+c
+      return
+      end
                                                                                 
                                                                                 
                                                                                 
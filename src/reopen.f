@@ -4,7 +4,7 @@ c     *                      subroutine reopen                       *
 c     *                                                              *
 c     *                      written by : bh                         *
 c     *                                                              *
-c     *                   last modified : 12/3/2019 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *          read restart file. get solution start up            *
 c     *                                                              *
@@ -113,6 +113,23 @@ c                       variable to catch any inconsistencies
 c                       between the previous save and the reopen here
 c
 c
+c                       restart format version. files written
+c                       before the version record was added start
+c                       directly with the error flags (version 0).
+c                       see store for the version history.
+c
+      read(fileno) dumi, restart_file_version
+      if( dumi .ne. restart_format_key ) then
+         restart_file_version = 0
+         rewind fileno
+      end if
+      if( restart_file_version .gt. restart_format_version ) then
+         write(out,9250) restart_file_version, restart_format_version
+         call die_abort
+      end if
+      if( restart_file_version .lt. restart_format_version )
+     &   write(out,9260) restart_file_version
+c
 c                       read error flags
 c
 c
@@ -188,6 +205,23 @@ c
       call chk_data_key( fileno, 1, 2 )
 c
 c
+c                       solution parameters added in format version
+c                       1. older files keep the values set at startup
+c                       (initst).
+c
+c
+      if( restart_file_version .ge. 1 ) then
+        read(fileno) adapt_target_iters, arc_target_iters,
+     &               anderson_depth
+        read(fileno) deterministic_ifv, estiff_single_prec,
+     &               cep_single_prec, extrap_quadratic, arc_length,
+     &               ls_cheap_trials, explicit_dynamics, solver_auto,
+     &               anderson_accel, umat_per_point
+        read(fileno) arc_radius, arc_lambda, explicit_dt_fraction
+        call chk_data_key( fileno, 1, 3 )
+      end if
+c
+c
 c                       read in real variables -- also initialize the
 c                          time limit procedures
 c
@@ -855,6 +889,11 @@ c
  9220 format(15x,'> user routine data read...')
  9230 format(15x,'> initial stress data read...')
  9240 format(15x,'> initial state arrays read...')
+ 9250 format(/1x,'>>>>> FATAL ERROR: restart file format version ',i3,
+     &  /,1x,'                   is newer than this executable (',i3,
+     &  ')',/,1x,'                   job terminated....',//)
+ 9260 format(15x,'> restart file format version ',i3,'. parameters',
+     &  ' added later keep their defaults')
       return
       end
 c     ****************************************************************
@@ -925,7 +964,7 @@ c     *                      subroutine history_cep_init             *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 04/28/12 rhd               *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     create the blocked data structure for storage of element *
 c     *     history data at step n and n+1. also current [D] mats    *
@@ -939,7 +978,8 @@ c
 c
       use elem_block_data, only : history_blocks, history1_blocks,
      &                            history_blk_list, gausspts_blk_list,
-     &                            cep_blocks, cep_blk_list
+     &                            cep_blocks, cep_blk_list,
+     &                            cep_blocks_sp
 c
       implicit integer (a-z)
       double precision :: dummy(1)
@@ -1001,6 +1041,13 @@ c
            call die_abort
            stop
       end if
+      allocate( cep_blocks_sp(nelblk), stat=alloc_stat )
+      if ( alloc_stat .ne. 0 ) then
+           write(out,9900)
+           write(out,9910) 9
+           call die_abort
+           stop
+      end if
 c
       history_blk_list(1:nelblk)  = 0
       gausspts_blk_list(1:nelblk) = 0
@@ -1091,6 +1138,7 @@ c
         end if
 c
         cep_blk_list(blk)  = cep_size
+        call cep_blk_compact( blk )
 c
       end do
       return
@@ -1102,6 +1150,64 @@ c
       end
 c     ****************************************************************
 c     *                                                              *
+c     *                 subroutines cep_blk_expand                   *
+c     *                             cep_blk_compact                  *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     gather/scatter a block of [D]s between the single        *
+c     *     precision store and the double precision cep_blocks      *
+c     *     the material and stiffness routines work on. no-ops      *
+c     *     for double precision storage. called by the thread       *
+c     *     processing the block                                     *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine cep_blk_expand( blk )
+      use elem_block_data, only : cep_blocks, cep_blocks_sp
+      use main_data, only : cep_single_prec
+      implicit none
+c
+      integer :: blk, n
+c
+      if( .not. allocated( cep_blocks_sp ) ) return
+      if( allocated( cep_blocks(blk)%vector ) ) return
+      if( .not. allocated( cep_blocks_sp(blk)%vector ) ) return
+c
+      n = size( cep_blocks_sp(blk)%vector )
+      allocate( cep_blocks(blk)%vector(n) )
+      cep_blocks(blk)%vector(1:n) = dble( cep_blocks_sp(blk)%vector )
+c
+c              switched to double precision storage. release
+c
+      if( .not. cep_single_prec )
+     &   deallocate( cep_blocks_sp(blk)%vector )
+c
+      return
+      end
+c
+      subroutine cep_blk_compact( blk )
+      use elem_block_data, only : cep_blocks, cep_blocks_sp
+      use main_data, only : cep_single_prec
+      implicit none
+c
+      integer :: blk, n
+c
+      if( .not. cep_single_prec ) return
+      if( .not. allocated( cep_blocks(blk)%vector ) ) return
+c
+      n = size( cep_blocks(blk)%vector )
+      if( .not. allocated( cep_blocks_sp(blk)%vector ) )
+     &   allocate( cep_blocks_sp(blk)%vector(n) )
+      cep_blocks_sp(blk)%vector(1:n) = real( cep_blocks(blk)%vector )
+      deallocate( cep_blocks(blk)%vector )
+c
+      return
+      end
+c     ****************************************************************
+c     *                                                              *
 c     *                      subroutine cdest_init                   *
 c     *                                                              *
 c     *                       written by : rhd                       *
@@ -2162,7 +2268,7 @@ c     *               subroutine chk_data_key                        *
 c     *                                                              *
 c     *                    written by : rhd                          *
 c     *                                                              *
-c     *                last modified : 2/20/01                       *
+c     *                last modified : 10/19/2026 agent              *
 c     *                                                              *
 c     *     check that next record of restart file is a data key     *
 c     *     if not, terminate. caller passes level and sub-level     *
@@ -2173,6 +2279,8 @@ c
 c
 c
       subroutine chk_data_key( fileno, level1, level2 )
+      use main_data, only : restart_file_version,
+     &                      restart_format_version
       implicit integer (a-z)
 c
       data check_data_key / 2147483647 /
@@ -2180,12 +2288,14 @@ c
       read (fileno,end=100) checkvar
 c
       if ( checkvar .ne. check_data_key ) then
-         write(*,9000) level1, level2
+         write(*,9000) level1, level2, restart_file_version,
+     &                 restart_format_version
          call die_abort
       end if
       return
 c
- 100  write(*,9100) level1, level2
+ 100  write(*,9100) level1, level2, restart_file_version,
+     &              restart_format_version
       call die_abort
 
 c
@@ -2195,12 +2305,16 @@ c
      &  /,"                restart file. the check for embedded data",
      &  /,"                keys failed. point of failure is",
      &  /,"                level: ",i4," sub-level: ",i4,
+     &  /,"                file format version: ",i3,
+     &    " (this executable writes: ",i3,")",
      &  /,"                job terminated...." ///)
  9100 format(
      & //,">  FATAL ERROR: unexpected end-of-file while reading",
      &  /,"                restart file. the check for embedded data",
      &  /,"                keys failed. point of failure is",
      &  /,"                level: ",i4," sublevel: ",i4,
+     &  /,"                file format version: ",i3,
+     &    " (this executable writes: ",i3,")",
      &  /,"                job terminated...." ///)
       end
 
@@ -2654,7 +2768,7 @@ c     *               subroutine read_alloc_cry                      *
 c     *                                                              *
 c     *                    written by : mcm                          *
 c     *                                                              *
-c     *                last modified : 12/23/2105 rhd                *
+c     *                last modified : 10/19/2026 agent              *
 c     *                                                              *
 c     *      Read the crystal data from file while allocating the    *
 c     *      appropriate structures.                                 *
@@ -2665,11 +2779,13 @@ c
       use global_data ! old common.main
       use crystal_data, only: c_array,data_offset,angle_input,
      &      crystal_input, srequired, nangles, simple_angles,
-     &      mc_array, defined_crystal
+     &      mc_array, defined_crystal, cluster_rep, cluster_wgt
+      use main_data, only : restart_file_version
       implicit integer (a-z)
       integer, intent(in) :: fileno
 c
-      integer :: nelem
+      integer :: nelem, nrow, ncol
+      logical :: clusters
 c
       read(fileno) defined_crystal
 c
@@ -2705,6 +2821,21 @@ c
         end if
         read(fileno) mc_array
       end if
+c
+c                       reduced-order crystal groups (format version 2).
+c                       older files: mm10_set_history_locs builds them
+c                       from the orientations
+c
+      if( restart_file_version < 2 ) return
+      read(fileno) clusters
+      if( clusters ) then
+        read(fileno) nrow, ncol
+        if( allocated( cluster_rep ) )
+     &      deallocate( cluster_rep, cluster_wgt )
+        allocate( cluster_rep(nrow,ncol), cluster_wgt(nrow,ncol) )
+        read(fileno) cluster_rep
+        read(fileno) cluster_wgt
+      end if
 c
       return
       end subroutine
@@ -185,8 +185,8 @@ c             system in which the normal axis (Z rotated) is
 c             perpendicular to the surface ot the cohesive element
 c
       if( local_work%is_cohes_elem ) then
-           call cohes_rot_mat( span, felem, nnode, elem_type,
-     &                         local_work%ce_n1,
+           call cohes_rot_mat_blk( local_work%blk, geonl, span, felem,
+     &                         nnode, elem_type, local_work%ce_n1,
      &                         local_work%cohes_rot_block )
         if ( geonl )
      &      call cohes_mirror_refsurf( span, mxvl, totdof, nnode,
@@ -194,19 +194,16 @@ c
       end if
 c
       do gpn = 1, ngp
-        call getgpts( elem_type, order, gpn, xi, eta, zeta,
-     &                local_work%weights(gpn) )
-        call derivs( elem_type, xi, eta, zeta, local_work%nxi(1,gpn),
-     &               local_work%neta(1,gpn),local_work%nzeta(1,gpn) )
+        call gp_shape_lookup( elem_type, order, gpn, ngp, nnode,
+     &               local_work%is_cohes_elem, xi, eta, zeta,
+     &               local_work%weights(gpn), local_work%nxi(1,gpn),
+     &               local_work%neta(1,gpn), local_work%nzeta(1,gpn),
+     &               local_work%shape(1,gpn) )
         call jacob1( elem_type, span, felem, gpn, local_work%jac,
      &    local_work%det_j(1,gpn), local_work%gama(1,1,1,gpn),
      &    local_work%cohes_rot_block,
      &    local_work%nxi(1,gpn), local_work%neta(1,gpn),
      &    local_work%nzeta(1,gpn), local_work%ce_n1, nnode )
-c
-        if ( local_work%is_cohes_elem )
-     &     call shapef( elem_type, xi, eta, zeta,
-     &                  local_work%shape(1,gpn) )
 c
         if ( bbar .and. elem_type .eq. 2 ) then
           call vol_terms( local_work%gama(1,1,1,gpn),
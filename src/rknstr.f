@@ -82,8 +82,8 @@ c
 c           note: for small displacements, ce_mid, ce_n1 = ce_0
 c
        if( cohesive_elem ) then
-           call cohes_rot_mat( span, felem, nnode, elem_type,
-     &                         local_work%ce_n1,
+           call cohes_rot_mat_blk( local_work%blk, geonl, span, felem,
+     &                         nnode, elem_type, local_work%ce_n1,
      &                         local_work%cohes_rot_block )
            if( geonl )
      &       call cohes_mirror_refsurf( span, mxvl, totdof, nnode,
@@ -485,10 +485,11 @@ c
       do gpn = 1, ngp
        if( local_debug ) write(*,9050)  gpn, elem_type
        local_work%gpn = gpn
-       call getgpts( elem_type, order, gpn, xi, eta, zeta,
-     &               local_work%weights(gpn) )
-       call derivs( elem_type, xi, eta, zeta, local_work%nxi(1,gpn),
-     &              local_work%neta(1,gpn), local_work%nzeta(1,gpn) )
+       call gp_shape_lookup( elem_type, order, gpn, ngp, nnode,
+     &              compute_shape, xi, eta, zeta,
+     &              local_work%weights(gpn),
+     &              local_work%nxi(1,gpn), local_work%neta(1,gpn),
+     &              local_work%nzeta(1,gpn), local_work%shape(1,gpn) )
        if( local_debug .and. gpn .eq. 1 ) then
           write(iout,9000) gpn, elem_type, xi, eta, zeta
           write(iout,9005)
@@ -514,10 +515,6 @@ c
      &              local_work%nzeta(1,gpn),
      &              local_work%ce_mid, nnode )
         end if
-c
-       if( compute_shape )
-     &     call shapef( elem_type, xi, eta, zeta,
-     &                  local_work%shape(1,gpn) )
 c
        if( bbar ) then
          call vol_terms( local_work%gama_mid(1,1,1,gpn),
@@ -564,10 +561,11 @@ c
 c
       do gpn = 1, ngp
         local_work%gpn = gpn
-        call getgpts( elem_type, order, gpn, xi, eta, zeta,
-     &                local_work%weights(gpn) )
-        call derivs( elem_type, xi, eta, zeta, local_work%nxi(1,gpn),
-     &               local_work%neta(1,gpn),local_work% nzeta(1,gpn) )
+        call gp_shape_lookup( elem_type, order, gpn, ngp, nnode,
+     &               compute_shape, xi, eta, zeta,
+     &               local_work%weights(gpn), local_work%nxi(1,gpn),
+     &               local_work%neta(1,gpn), local_work%nzeta(1,gpn),
+     &               local_work%shape(1,gpn) )
         if( local_debug .and. gpn .eq. 1 ) then
           write(iout,9000) gpn, elem_type, xi, eta, zeta
           write(iout,9005)
@@ -581,10 +579,6 @@ c
      &    local_work%cohes_rot_block,
      &    local_work%nxi(1,gpn), local_work%neta(1,gpn),
      &    local_work%nzeta(1,gpn), local_work%ce_0, nnode )
-c
-        if( compute_shape )
-     &     call shapef( elem_type, xi, eta, zeta,
-     &                  local_work%shape(1,gpn) )
 c
         if( bbar ) then
           call vol_terms( local_work%gama(1,1,1,gpn),
@@ -673,10 +667,11 @@ c
 c
 c              1. Gauss point coords, shape function derivatives
 c
-      call getgpts( elem_type, order, gpn, xi, eta, zeta,
-     &               local_work%weights(gpn) )
-      call derivs( elem_type, xi, eta, zeta, local_work%nxi(1,gpn),
-     &              local_work%neta(1,gpn), local_work%nzeta(1,gpn) )
+      call gp_shape_lookup( elem_type, order, gpn, ngp, nnode,
+     &              compute_shape, xi, eta, zeta,
+     &              local_work%weights(gpn),
+     &              local_work%nxi(1,gpn), local_work%neta(1,gpn),
+     &              local_work%nzeta(1,gpn), local_work%shape(1,gpn) )
 c
 c              2. coordinate jacobian at t = n+1/2
 c
@@ -723,10 +718,6 @@ c
      &              error )
       i_detF_n1(1:span) = i_detF_n1(1:span) +
      &                    detF_local(1:span) * det_j(1:span)
-c
-      if( compute_shape )
-     &     call shapef( elem_type, xi, eta, zeta,
-     &                  local_work%shape(1,gpn) )
 c
       if( bbar ) then
          call vol_terms( local_work%gama_mid(1,1,1,gpn),
@@ -1558,7 +1549,8 @@ c
       use segmental_curves
       use main_data, only : matprp, lmtprp, imatprp, dmatprp, smatprp
       use crystal_data, only : c_array, angle_input, crystal_input,
-     &                              data_offset
+     &                         data_offset, orient_cache,
+     &                         orient_index_input, orient_index_matl
 c
       implicit none
       include 'param_def'
@@ -1572,15 +1564,9 @@ c
 c
 c                    local
 c
-      integer :: i, out, matnum, ctotal, c, cnum, s, elnum, osn
-      double precision :: angles(3), bs(3), ns(3), temp66(6,6),
-     &                    rot(3,3), trans_rot(3,3),
-     &                    temp_vec3(3),
-     &                    A(3,3), trans_A(3,3), A_symm(3,3),
-     &                    A_asymm(3,3),
-     &                    Rstiff(6,6), trans_Rstiff(6,6)
-      double precision, parameter :: half = 0.5d00, zero = 0.0d00
-      character :: aconv*5, atype*7
+      integer :: i, out, matnum, ctotal, c, cnum, elnum, osn, centry,
+     &           nsl
+      double precision :: angles(3)
 c
       ctotal = 0
       out = local_work%iout
@@ -1601,22 +1587,9 @@ c
 c
          call setup_mm10_rknstr_a( 2 ) ! get data for this crystal
          call setup_mm10_rknstr_a( 3 ) ! put props into local_work
-         call setup_mm10_rknstr_a( 4 ) ! get crystal->reference rot
-c
-c                     set up and rotate our orientation tensors
-c
-         rot       = local_work%c_props(i,c)%rotation_g
-         call set_up_mm10_rknstr_c( trans_rot, rot, 3 )
-         call setup_mm10_rknstr_a( 5 ) ! get crystal->reference rots
-c
-c                      rotate forward our stiffness tensor
-c
-         call mm10_RT2RVE( trans_rot, Rstiff ) ! makes Rstiff
-         call set_up_mm10_rknstr_c( trans_Rstiff, Rstiff, 6)
-         temp66 = matmul( local_work%c_props(i,c)%init_elast_stiff,
-     &                       trans_Rstiff )
-         local_work%c_props(i,c)%init_elast_stiff = matmul(
-     &               Rstiff, temp66 )   ! 6x6 * 6xx
+         call setup_mm10_rknstr_a( 4 ) ! crystal->reference rot,
+c                                         rotated stiffness & slip
+c                                         tensors
        end do ! on crystals
 c
            ctotal = ctotal + local_work%ncrystals(i)
@@ -1640,88 +1613,6 @@ c
 
       contains
 c     ========
-      subroutine set_up_mm10_rknstr_b( a, b, c )
-      implicit none
-      double precision :: a(3), b(3,3), c(3)
-c
-c                     a = [b] * c
-c
-      a(1) = b(1,1)*c(1) + b(1,2)*c(2) + b(1,3)*c(3)
-      a(2) = b(2,1)*c(1) + b(2,2)*c(2) + b(2,3)*c(3)
-      a(3) = b(3,1)*c(1) + b(3,2)*c(2) + b(3,3)*c(3)
-c
-      return
-      end subroutine set_up_mm10_rknstr_b
-
-      subroutine set_up_mm10_rknstr_c( a, b, n )
-      implicit none
-      integer :: n, i, j
-      double precision :: a(n,n), b(n,n)
-c
-c                     a = trans[ b ]
-c
-      if( n .eq. 3 ) then
-         do i = 1, 3
-!DIR$ VECTOR ALIGNED
-            do j = 1, 3
-               a(i,j) = b(j,i)
-            end do
-         end do
-         return
-      end if
-c
-       do i = 1, 6
-!DIR$ VECTOR ALIGNED
-         do j = 1, 6
-            a(i,j) = b(j,i)
-         end do
-      end do
-c
-      return
-      end subroutine set_up_mm10_rknstr_c
-
-      subroutine set_up_mm10_rknstr_d( trans_A, A, bs, ns )
-      implicit none
-c
-      integer :: i, j
-      double precision :: trans_A(3,3), A(3,3), bs(3), ns(3)
-c
-      double precision :: spreadbs(3,3), spreadns(3,3)
-c
-      spreadbs(1,1) = bs(1)
-      spreadbs(2,1) = bs(2)
-      spreadbs(3,1) = bs(3)
-      spreadbs(1,2) = bs(1)
-      spreadbs(2,2) = bs(2)
-      spreadbs(3,2) = bs(3)
-      spreadbs(1,3) = bs(1)
-      spreadbs(2,3) = bs(2)
-      spreadbs(3,3) = bs(3)
-c
-      spreadns(1,1) = ns(1)
-      spreadns(2,1) = ns(1)
-      spreadns(3,1) = ns(1)
-      spreadns(1,2) = ns(2)
-      spreadns(2,2) = ns(2)
-      spreadns(3,2) = ns(2)
-      spreadns(1,3) = ns(3)
-      spreadns(2,3) = ns(3)
-      spreadns(3,3) = ns(3)
-c
-      do i = 1, 3
-!DIR$ VECTOR ALIGNED
-        do j = 1, 3
-         A(i,j) = spreadbs(i,j) * spreadns(i,j)
-         trans_A(j,i) = A(i,j)
-        end do
-      end do
-c
-      return
-c
-      end  subroutine set_up_mm10_rknstr_d
-
-
-
 
       subroutine setup_mm10_rknstr_a( dowhat )
       implicit none
@@ -1967,51 +1858,48 @@ c
 c
       case( 4 )
 c
-c          reference rotation
+c          these depend only on the crystal and its initial angles.
+c          use the orientation cache built at setup when it has
+c          the entry. otherwise compute them here
 c
-        if (local_work%angle_type(i) .eq. 1) then
-              atype = "degrees"
-        elseif (local_work%angle_type(i) .eq. 2) then
-              atype = "radians"
+        centry = 0
+        if( imatprp(104,matnum) == 2 .or.
+     &      imatprp(107,matnum) == 2 ) then
+          if( allocated( orient_index_input ) ) 
+     &      centry = orient_index_input(data_offset(elnum),c)
         else
-              write(out,9503)
-              call die_gracefully
+          if( allocated( orient_index_matl ) )
+     &      centry = orient_index_matl(matnum)
         end if
-        if (local_work%angle_convention(i) .eq. 1) then
-              aconv="kocks"
-        else
-              write(out,9504)
-              call die_gracefully
+c
+        if( centry == 0 ) then
+          call mm10_orient_crystal( cnum, angles,
+     &         local_work%angle_type(i),
+     &         local_work%angle_convention(i),
+     &         local_work%c_props(i,c)%rotation_g,
+     &         local_work%c_props(i,c)%init_elast_stiff, max_slip_sys,
+     &         local_work%c_props(i,c)%ms, local_work%c_props(i,c)%qs,
+     &         local_work%c_props(i,c)%ns )
+          return
         end if
-        call mm10_rotation_matrix( local_work%c_props(i,c)%init_angles,
-     &        aconv, atype, local_work%c_props(i,c)%rotation_g, out )
-c
-      case( 5 )
-c
-c          rotation on each slip system for this crystal
-c
-        do s = 1, local_work%c_props(i,c)%nslip
-            temp_vec3 = c_array(cnum)%bi(s,1:3)
-            call set_up_mm10_rknstr_b( bs, trans_rot, temp_vec3 )
-            temp_vec3 =  c_array(cnum)%ni(s,1:3)
-            call set_up_mm10_rknstr_b( ns, trans_rot, temp_vec3 )
-            local_work%c_props(i,c)%ns(1:3,s) = ns
-            call set_up_mm10_rknstr_d( trans_A, A, bs, ns )
-            A_symm  = half * ( A + trans_A )
-            A_asymm = half * ( A - trans_A )
-            call mm10_ET2EV( A_symm,  local_work%c_props(i,c)%ms(1,s) )
-            call mm10_WT2WV( A_asymm, local_work%c_props(i,c)%qs(1,s) )
-        end do ! on slip systems
-
+c
+        nsl = orient_cache(centry)%nslip
+        local_work%c_props(i,c)%rotation_g =
+     &          orient_cache(centry)%rotation_g
+        local_work%c_props(i,c)%init_elast_stiff =
+     &          orient_cache(centry)%elast_stiff
+        local_work%c_props(i,c)%ms(1:6,1:nsl) =
+     &          orient_cache(centry)%ms(1:6,1:nsl)
+        local_work%c_props(i,c)%qs(1:3,1:nsl) =
+     &          orient_cache(centry)%qs(1:3,1:nsl)
+        local_work%c_props(i,c)%ns(1:3,1:nsl) =
+     &          orient_cache(centry)%ns(1:3,1:nsl)
+c
       end select
 c
       return
  9502 format(/,1x,'>>>> System error: unexpected input type in rknstr!',
      &            ' Aborting.'/)
- 9503 format(/,1x,'>>>> System error: unexpected angle type in rknstr!',
-     &            ' Aborting.'/)
- 9504 format(/,1x,'>>>> System error: unexpected angle conv in rknstr!',
-     &            ' Aborting.'/)
 
 c
       end subroutine setup_mm10_rknstr_a
@@ -107,8 +107,8 @@ c             perpendicular to the referernce surface of the
 c             cohesive element
 c
       if( local_work%is_cohes_elem )  then
-            call cohes_rot_mat( span, felem, nnode, type,
-     &                          local_work%ce,
+            call cohes_rot_mat_blk( local_work%blk, geonl, span,
+     &                          felem, nnode, type, local_work%ce,
      &                          local_work%cohes_rot_block )
           if ( geonl )
      &      call cohes_mirror_refsurf( span, mxvl, totdof, nnode,
@@ -116,12 +116,11 @@ c
       end if
 c
       do gpn = 1, ngp
-         call getgpts( type, order, gpn, xi, eta, zeta,
-     &                 local_work%weights(gpn) )
-         call derivs( type, xi, eta, zeta, local_work%nxi(1,gpn),
-     &                local_work%neta(1,gpn), local_work%nzeta(1,gpn) )
-         if( compute_shape )
-     &      call shapef( type, xi, eta, zeta, local_work%shape(1,gpn) )
+         call gp_shape_lookup( type, order, gpn, ngp, nnode,
+     &                compute_shape, xi, eta, zeta,
+     &                local_work%weights(gpn), local_work%nxi(1,gpn),
+     &                local_work%neta(1,gpn), local_work%nzeta(1,gpn),
+     &                local_work%shape(1,gpn) )
          call jacob1( type, span, felem, gpn, local_work%jac_block,
      &                local_work%det_jac_block(1,gpn),
      &                local_work%gama_block(1,1,1,gpn),
@@ -1590,7 +1590,7 @@ c     *                  subroutine drive_03_update                  *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *             last modified : 8/30/2018 rhd                    *
+c     *             last modified : 10/19/2026 agent                 *
 c     *                                                              *
 c     *     drives material model 03 to update stresses and history  *
 c     *     for all elements in the block at 1 integration point     *
@@ -1644,7 +1644,7 @@ c
       integer :: span, felem, type, order, ngp, nnode, ndof, step,
      &           iter, now_blk, mat_type, number_points, curve_set,
      &           hist_size_for_blk, curve_type, elem_type, i,
-     &           numrows_stress
+     &           numrows_stress, k, num_plastic, plastic_list(mxvl)
 c
       data zero, trans_factor / 0.0d00, 0.95d00 /
 c
@@ -1981,7 +1981,7 @@ c     *                 subroutine drive_03_update_a                 *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 11/9/2015 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     ****************************************************************
 c
@@ -2117,10 +2117,48 @@ c
       args%step_scale_fact       = step_scale_fact
       args%rate_depend_segmental = curve_type .eq. 2
 c
-!DIR$ VECTOR ALIGNED
-      do i = 1, span
-        if( null_point(i) ) cycle
-        if( .not. local_work%nonlinear_flag(i) ) cycle
+c                 points that stay elastic or unload elastically are
+c                 finished over the whole span in mm03e. only those
+c                 loading plastically go through the return mapping.
+c                 with linear or power-law curves the mises points
+c                 all together in mm03v, then the gurson points all
+c                 together in mm03gv. segmental curves one point at
+c                 a time in mm03.
+c
+      call mm03e(
+     &       span, gpn, felem, hist_size_for_blk, signal_flag, iout,
+     &       null_point, local_work%nonlinear_flag, copy_sigyld_vec,
+     &       uddt, stress_n, stress_n1, local_work%elem_hist(1,1,1),
+     &       local_work%elem_hist1(1,1,1), yld_func, plastic_list,
+     &       num_plastic )
+c
+      if( .not. segmental ) call mm03v(
+     &       span, gpn, felem, hist_size_for_blk, signal_flag,
+     &       allow_cut, iout, dtime, local_work%e_vec,
+     &       local_work%nu_vec, copy_sigyld_vec, local_work%f0_vec,
+     &       local_work%nuc_vec, local_work%eps_ref_vec,
+     &       local_work%m_power_vec, local_work%n_power_vec,
+     &       local_work%h_vec, uddt, stress_n, stress_n1,
+     &       local_work%elem_hist(1,1,1),
+     &       local_work%elem_hist1(1,1,1), yld_func, q_trial,
+     &       plastic_list, num_plastic, material_cut_step )
+c
+      if( .not. segmental ) call mm03gv(
+     &       span, gpn, felem, hist_size_for_blk, signal_flag,
+     &       allow_cut, iout, dtime, local_work%e_vec,
+     &       local_work%nu_vec, copy_sigyld_vec,
+     &       local_work%eps_ref_vec, local_work%m_power_vec,
+     &       local_work%n_power_vec, local_work%h_vec,
+     &       local_work%q1_vec, local_work%q2_vec, local_work%q3_vec,
+     &       local_work%nuc_vec, local_work%nuc_s_n_vec,
+     &       local_work%nuc_e_n_vec, local_work%nuc_f_n_vec, uddt,
+     &       stress_n, stress_n1, local_work%rtse,
+     &       local_work%elem_hist(1,1,1),
+     &       local_work%elem_hist1(1,1,1), yld_func,
+     &       plastic_list, num_plastic, material_cut_step )
+c
+      do k = 1, num_plastic
+        i = plastic_list(k)
         now_blk_relem = i
         args%abs_element = felem+i-1
         args%relem = i
@@ -3643,18 +3681,20 @@ c     *            subroutine drive_umat_update  (umat)              *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified: 9/16/2018 rhd               *
+c     *                   last modified: 10/19/2026 agent            *
 c     *                                                              *
 c     *     drives material model 08 (Abaqus umat) to update         *
 c     *     stresses and history for all elements in block at        *
-c     *     integration point gpn                                    *
+c     *     integration point gpn. umats that provide umat_batch     *
+c     *     get the whole span in one call                           *
 c     *                                                              *
 c     ****************************************************************
 c
 c
       subroutine drive_umat_update( gpn, local_work, uddt, qn1, iout )
       use main_data, only : nonlocal_analysis,
-     &                      extrapolated_du, non_zero_imposed_du
+     &                      extrapolated_du, non_zero_imposed_du,
+     &                      umat_batch_scratch
       use segmental_curves, only : max_seg_points
       use elem_block_data, only : nonlocal_flags, nonlocal_data_n1,
      &                            gbl_cep_blocks => cep_blocks
@@ -3674,7 +3714,7 @@ c
      &           now_blk, hist_size_for_blk, knumthreads, kthread,
      &           max_nstatv, ndi, nshr, ntens, npt, layer, kspt,
      &           kstep, kinc, kiter, kout,nstatv, k, ielem, noel,
-     &           nprops, j, nj, start_loc, n
+     &           nprops, j, nj, start_loc, n, batch_pass, nscratch
       double precision ::
      &  gp_temps(mxvl), gp_rtemps(mxvl), gp_dtemps(mxvl),
      &  zero, one, half, ddsddt(6), drplde(6), drpldt,
@@ -3691,13 +3731,22 @@ c
      &  nonloc_ele_values(nonlocal_shared_state_size),
      &  sys_vals(nonlocal_shared_state_size), dstran_temps_only(6),
      &  dstran_displ_only(6), uddt_temps(mxvl,nstr)
+c
+c                       structure-of-arrays copies of the umat
+c                       arguments for the span-batched interface
+c
+      double precision, allocatable :: b_stress(:,:), b_statev(:,:),
+     &  b_ddsdde(:,:,:), b_sse(:), b_spd(:), b_scd(:), b_stran(:,:),
+     &  b_dstran(:,:), b_temp_n(:), b_dtemp(:), b_props(:,:),
+     &  b_coords(:,:), b_pnewdt(:), b_celent(:), b_dfgrd0(:,:,:),
+     &  b_dfgrd1(:,:,:), b_nonloc(:,:)
 c
       equivalence (dfgrd0, dfgrd0_array),  (dfgrd1, dfgrd1_array)
 c
       logical :: signal_flag, local_debug, debug_now, temperatures,
      &        temperatures_ref, init_sig_eps, init_history,
      &        chk_umat_support, chk, chk2, do_nonlocal,
-     &        process_flag
+     &        process_flag, batched
       integer :: map(6)
       character(len=8) :: cmname
       data zero, one, big, check_key, half / 0.0d00, 1.0d00, 1.0d06,
@@ -3864,6 +3913,26 @@ c
 c               5. drive update over all elements in the block at this
 c                  material point. the Abaqus umat processes 1
 c                  point per call.
+c
+c                  a umat_batch runs the element loop twice. pass 1
+c                  sets up the umat arguments for each element and
+c                  packs them into span arrays. umat_batch then
+c                  updates all elements in one call. pass 2 unpacks
+c                  the results and does the usual processing of umat
+c                  results element by element.
+c
+      batched    = local_work%umat_batch
+      batch_pass = 1
+      if( batched ) then
+        n = nonlocal_shared_state_size
+        allocate( b_stress(mxvl,6), b_statev(mxvl,nstatv+1),
+     &            b_ddsdde(mxvl,6,6), b_sse(mxvl), b_spd(mxvl),
+     &            b_scd(mxvl), b_stran(mxvl,6), b_dstran(mxvl,6),
+     &            b_temp_n(mxvl), b_dtemp(mxvl), b_props(mxvl,50),
+     &            b_coords(mxvl,3), b_pnewdt(mxvl), b_celent(mxvl),
+     &            b_dfgrd0(mxvl,3,3), b_dfgrd1(mxvl,3,3),
+     &            b_nonloc(mxvl,n) )
+      end if
 c
  1000 continue
 c
@@ -3980,6 +4049,41 @@ c                   is to subtract the thermal strain increment for
 c                   step from dtran and immediately return (if the umat
 c                   is handling temperature effects)
 c
+c                   batched: pack on pass 1, unpack umat_batch results
+c                   on pass 2
+c
+      if( batched .and. batch_pass .eq. 1 ) then
+        b_stress(ielem,1:6)          = stress(1:6)
+        b_statev(ielem,1:nstatv+1)   = statev(1:nstatv+1)
+        b_ddsdde(ielem,1:6,1:6)      = ddsdde(1:6,1:6)
+        b_sse(ielem)                 = sse
+        b_spd(ielem)                 = spd
+        b_scd(ielem)                 = scd
+        b_stran(ielem,1:6)           = stran(1:6)
+        b_dstran(ielem,1:6)          = dstran(1:6)
+        b_temp_n(ielem)              = temp_n
+        b_dtemp(ielem)               = dtemp
+        b_props(ielem,1:nprops)      = abq_props(1:nprops)
+        b_coords(ielem,1:3)          = coords(1:3)
+        b_pnewdt(ielem)              = pnewdt
+        b_celent(ielem)              = celent
+        b_dfgrd0(ielem,1:3,1:3)      = dfgrd0_array(1:3,1:3)
+        b_dfgrd1(ielem,1:3,1:3)      = dfgrd1_array(1:3,1:3)
+        b_nonloc(ielem,1:n)          = nonloc_ele_values(1:n)
+        cycle
+      end if
+c
+      if( batched ) then
+        stress(1:6)          = b_stress(ielem,1:6)
+        statev(1:nstatv+1)   = b_statev(ielem,1:nstatv+1)
+        ddsdde(1:6,1:6)      = b_ddsdde(ielem,1:6,1:6)
+        sse                  = b_sse(ielem)
+        spd                  = b_spd(ielem)
+        scd                  = b_scd(ielem)
+        dstran(1:6)          = b_dstran(ielem,1:6)
+        pnewdt               = b_pnewdt(ielem)
+        nonloc_ele_values(1:n) = b_nonloc(ielem,1:n)
+      else
       call umat(   !   up means changeable by umat
      1   stress,   ! up
      2   statev, ! up
@@ -4003,6 +4107,7 @@ c
      k   noel, npt, layer,
      l   kspt, kstep, kinc, kiter, kout, kthread, knumthreads,
      m   nonloc_ele_values, nonlocal_shared_state_size )
+      end if
 c
 c               5.9 make sure umat did not overwite the declared
 c                   number of state variables.
@@ -4164,6 +4269,28 @@ c               5.16 end of loop over all elements in block at this
 c                    material point.
 c
       end do ! over elements
+c
+c               5.17 batched umat. one call for the span, then back
+c                    through the element loop to process results.
+c                    each thread has its own column of scratch.
+c
+      if( batched .and. batch_pass .eq. 1 ) then
+        nscratch = size( umat_batch_scratch, 1 )
+        call umat_batch( span, mxvl, felem, npt,
+     &     b_stress, b_statev, b_ddsdde, b_sse, b_spd, b_scd,
+     &     b_stran, b_dstran, time, dtime, b_temp_n, b_dtemp,
+     &     ndi, nshr, ntens, nstatv, b_props, nprops, b_coords,
+     &     b_pnewdt, b_celent, b_dfgrd0, b_dfgrd1,
+     &     kstep, kinc, kiter, kout, kthread, knumthreads,
+     &     b_nonloc, n, umat_batch_scratch(1,kthread+1), nscratch )
+        batch_pass = 2
+        go to 1000
+      end if
+c
+      if( batched ) deallocate( b_stress, b_statev, b_ddsdde, b_sse,
+     &     b_spd, b_scd, b_stran, b_dstran, b_temp_n, b_dtemp,
+     &     b_props, b_coords, b_pnewdt, b_celent, b_dfgrd0,
+     &     b_dfgrd1, b_nonloc )
 
 c                    UMAT may have computed Cauchy stresses @ n+1
 c                    rather than unrotated Cauchy stresses. This
@@ -5096,7 +5223,7 @@ c     *                 subroutine material_model_info               *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 04/28/12                   *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     call the material model specific set up routine          *
 c     *     to get a vector of various data sizes, parameters        *
@@ -5140,10 +5267,18 @@ c
 c         4        number of state variables per point to be output
 c                  when user requests this type of results
 c
-      info_vector(1) = 0
-      info_vector(2) = 21
-      info_vector(3) = 0
-      info_vector(4) = 0
+c         5        umat only. = 1 the user supplies umat_batch which
+c                  updates all elements of a block at an integration
+c                  point in one call. = 0 per point umat
+c
+c         6        umat only. number of words of per-thread scratch
+c                  umat_batch wants
+c
+      info_vector(1)    = 0
+      info_vector(2)    = 21
+      info_vector(3)    = 0
+      info_vector(4)    = 0
+      info_vector(5:10) = 0
 c
       if( element_no .gt. 0 .and. block_no .gt. 0 ) then
          write(out,9000) 1
@@ -5208,7 +5343,7 @@ c
      &   call mm11_set_sizes_special(inter_mat,info_vector,
      &                               local_element_no)
 c
-      if( info_type .gt. 0 .and. info_type .le. 4 ) then
+      if( info_type .gt. 0 .and. info_type .le. 6 ) then
          value = info_vector(info_type)
       else
          write(out,9000) 5
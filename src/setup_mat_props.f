@@ -51,7 +51,7 @@ c     *                 subroutine set_up_segmental                  *
 c     *                                                              *
 c     *                       written by : rhd                       *
 c     *                                                              *
-c     *                   last modified : 07/29/2011                 *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *     set up the segmental stress-strain curve for each        *
 c     *     element in this block for the gauss point being          *
@@ -87,11 +87,11 @@ c
 c
 c                      local declarations
 c
+      integer :: k_np1(span), k_n(span)
       double precision
-     & linear_interpolate,  stress_val, big_num, point_temp_np1,
-     & point_temp_n, alpha, point_rate
+     & stress_val, big_num, alpha, dx_np1(span), dx_n(span),
+     & temps_n(span)
 c
-      external linear_interpolate
       logical local_debug
       data local_debug, big_num / .false., 1.0e30 /
 c
@@ -165,119 +165,98 @@ c
 c
 c                temperature dependent stress-strain curves.
 c                interpolate to build a unique stress-strain curve for
-c                this gauss point for each element in the block. first
-c                build a transposed table so that a column has
-c                the temperature dependent stress values for a plastic
-c                strain point on the curve. we also build temperature
-c                dependent elastic modulus, nu and isotropic thermal
-c                expansion coefficients at end of step and at start
-c                of step. note that temperature dependent alpha
-c                values must be isotropic.
+c                this gauss point for each element in the block. we
+c                also build temperature dependent elastic modulus, nu
+c                and isotropic thermal expansion coefficients at end
+c                of step and at start of step. note that temperature
+c                dependent alpha values must be isotropic.
 c
       case( 1 )
 c
-       if ( gpn .eq. 1 ) then
-!DIR$ VECTOR ALIGNED
-         do i = 1, num_curves_in_set
-          curve_no                   = seg_curve_table(i+1,curve_set)
-          curve_temps(i)             = seg_curves_value(curve_no)
-          curve_e_values(i)          = seg_curves_ym(curve_no)
-          curve_nu_values(i)         = seg_curves_nu(curve_no)
-          curve_alpha_values(i)      = seg_curves_alpha(curve_no)
-          curve_gp_sig_0_values(i)   = seg_curves_gp_sigma_0(curve_no)
-          curve_gp_h_u_values(i)     = seg_curves_gp_h_u(curve_no)
-          curve_gp_beta_u_values(i)  = seg_curves_gp_beta_u(curve_no)
-          curve_gp_delta_u_values(i) = seg_curves_gp_delta_u(curve_no)
-          do j = 1, num_points_on_curves
-            sigma_inter_table(i,j) = seg_curves(j,2,curve_no)
-          end do
-         end do
-       end if
+c                shared lookup table for the curve set: locate the
+c                temperature interval once per element at n and n+1,
+c                then every property and curve point is a gather
+c                plus one multiply-add.
+c
+       call seg_lookup_check( curve_set )
+       call seg_lookup_locate( curve_set, span, gp_temps, k_np1,
+     &                         dx_np1 )
+!DIR$ IVDEP
+       do ielem = 1, span
+         temps_n(ielem) = gp_temps(ielem) - gp_dtemps(ielem)
+       end do
+       call seg_lookup_locate( curve_set, span, temps_n, k_n, dx_n )
 c
        if ( local_debug ) write(*,9200)
 c
+       associate( t => seg_lookup(curve_set) )
+!DIR$ IVDEP
        do ielem = 1, span
-          point_temp_np1    = gp_temps(ielem)
-          point_temp_n      = gp_temps(ielem) - gp_dtemps(ielem)
+          k  = k_np1(ielem)
+          kn = k_n(ielem)
+          e_block(ielem)   = t%y(k,1) + dx_np1(ielem) * t%slope(k,1)
+          e_block_n(ielem) = t%y(kn,1) + dx_n(ielem) * t%slope(kn,1)
+          nu_block(ielem)   = t%y(k,2) + dx_np1(ielem) * t%slope(k,2)
+          nu_block_n(ielem) = t%y(kn,2) + dx_n(ielem) * t%slope(kn,2)
+          alpha = t%y(k,3) + dx_np1(ielem) * t%slope(k,3)
+          alpha_block(ielem,1) = alpha
+          alpha_block(ielem,2) = alpha
+          alpha_block(ielem,3) = alpha
+          alpha = t%y(kn,3) + dx_n(ielem) * t%slope(kn,3)
+          alpha_block_n(ielem,1) = alpha
+          alpha_block_n(ielem,2) = alpha
+          alpha_block_n(ielem,3) = alpha
+          gp_sig_0_block(ielem) = t%y(k,4) +
+     &                            dx_np1(ielem) * t%slope(k,4)
+          gp_sig_0_block_n(ielem) = t%y(kn,4) +
+     &                              dx_n(ielem) * t%slope(kn,4)
+          gp_h_u_block(ielem) = t%y(k,5) +
+     &                          dx_np1(ielem) * t%slope(k,5)
+          gp_h_u_block_n(ielem) = t%y(kn,5) +
+     &                            dx_n(ielem) * t%slope(kn,5)
+          gp_beta_u_block(ielem) = t%y(k,6) +
+     &                             dx_np1(ielem) * t%slope(k,6)
+          gp_beta_u_block_n(ielem) = t%y(kn,6) +
+     &                               dx_n(ielem) * t%slope(kn,6)
+          gp_delta_u_block(ielem) = t%y(k,7) +
+     &                              dx_np1(ielem) * t%slope(k,7)
+          gp_delta_u_block_n(ielem) = t%y(kn,7) +
+     &                                dx_n(ielem) * t%slope(kn,7)
           sigma_curve_min_values(ielem) = big_num
+       end do
 c
-          e_block(ielem) = linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_e_values )
-          e_block_n(ielem) = linear_interpolate( point_temp_n,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_e_values )
-          nu_block(ielem) = linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_nu_values )
-          nu_block_n(ielem) = linear_interpolate( point_temp_n,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_nu_values )
-          alpha =  linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_alpha_values )
-          alpha_block(ielem,1:3) = alpha
-          alpha =  linear_interpolate( point_temp_n,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_alpha_values )
-          alpha_block_n(ielem,1:3) = alpha
-c
-          gp_sig_0_block(ielem) = linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_sig_0_values )
-          gp_sig_0_block_n(ielem) = linear_interpolate( point_temp_n,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_sig_0_values )
-c
-          gp_h_u_block(ielem) = linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_h_u_values )
-          gp_h_u_block_n(ielem) = linear_interpolate( point_temp_n,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_h_u_values )
-c
-          gp_beta_u_block(ielem) = linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_beta_u_values )
-          gp_beta_u_block_n(ielem) = linear_interpolate( point_temp_n,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_beta_u_values )
-c
-          gp_delta_u_block(ielem) = linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_delta_u_values )
-          gp_delta_u_block_n(ielem) = linear_interpolate( point_temp_n,
-     &                        num_curves_in_set, curve_temps,
-     &                        curve_gp_delta_u_values )
-c
-          do curve_pt = 1, num_points_on_curves
-            stress_val = linear_interpolate( point_temp_np1,
-     &                        num_curves_in_set, curve_temps,
-     &                        sigma_inter_table(1,curve_pt) )
+       do curve_pt = 1, num_points_on_curves
+         col = seg_lookup_num_props + curve_pt
+!DIR$ IVDEP
+         do ielem = 1, span
+            k = k_np1(ielem)
+            stress_val = t%y(k,col) + dx_np1(ielem) * t%slope(k,col)
             sigma_curves(curve_pt,ielem) = stress_val
             sigma_curve_min_values(ielem) =
      &           min( sigma_curve_min_values(ielem), stress_val )
-          end do
+         end do
+       end do
+       end associate
 c
-          if ( local_debug ) then
+       if ( local_debug ) then
+         do ielem = 1, span
            write(*,9210) ielem, gp_temps(ielem),
      &                   sigma_curve_min_values(ielem)
            write(*,9215) e_block(ielem), nu_block(ielem)
            write(*,9220) (curve_pt, sigma_curves(curve_pt,ielem),
      &                    curve_pt=1,num_points_on_curves)
-          end if
-c
-       end do
+         end do
+       end if
 c
        return
 c
 c                strain-rate dependent stress-strain curves.
 c                interpolate to build a unique stress-strain curve for
-c                this gauss point for each element in the block. first
-c                build a transposed table so that a column has
-c                the rate dependent stress values for a plastic
-c                strain point on the curve. the elastic modulus,
-c                nu, thermal expansion are rate independent.
+c                this gauss point for each element in the block. the
+c                transposed table (a column has the rate dependent
+c                stress values for a plastic strain point) is still
+c                built for mm03sc. the elastic modulus, nu, thermal
+c                expansion are rate independent.
 
       case ( 2 )
 c
@@ -290,28 +269,40 @@ c
            end do
          end do
        end if
+c
+       call seg_lookup_check( curve_set )
+       call seg_lookup_locate( curve_set, span, gp_eps_rates, k_np1,
+     &                         dx_np1 )
 c
        if ( local_debug ) write(*,9240)
 c
+!DIR$ IVDEP
        do ielem = 1, span
-          point_rate    = gp_eps_rates(ielem)
-          sigma_curve_min_values(ielem) = big_num
-          do curve_pt = 1, num_points_on_curves
-            stress_val = linear_interpolate( point_rate,
-     &                        num_curves_in_set, curve_rates,
-     &                        sigma_inter_table(1,curve_pt) )
+         sigma_curve_min_values(ielem) = big_num
+       end do
+c
+       associate( t => seg_lookup(curve_set) )
+       do curve_pt = 1, num_points_on_curves
+         col = seg_lookup_num_props + curve_pt
+!DIR$ IVDEP
+         do ielem = 1, span
+            k = k_np1(ielem)
+            stress_val = t%y(k,col) + dx_np1(ielem) * t%slope(k,col)
             sigma_curves(curve_pt,ielem) = stress_val
             sigma_curve_min_values(ielem) =
      &           min( sigma_curve_min_values(ielem), stress_val )
-          end do
+         end do
+       end do
+       end associate
 c
-          if ( local_debug ) then
-           write(*,9230) ielem,point_rate,sigma_curve_min_values(ielem)
+       if ( local_debug ) then
+         do ielem = 1, span
+           write(*,9230) ielem, gp_eps_rates(ielem),
+     &                   sigma_curve_min_values(ielem)
            write(*,9220) (curve_pt, sigma_curves(curve_pt,ielem),
-     &                   curve_pt=1,num_points_on_curves)
-          end if
-c
-       end do
+     &                    curve_pt=1,num_points_on_curves)
+         end do
+       end if
 c
        if ( local_debug ) write(*,*) ' '
        return
@@ -343,6 +334,153 @@ c
 
 
 
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine seg_lookup_check                  *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     make sure the shared lookup table for a temperature or   *
+c     *     rate dependent curve set exists. first thread in builds  *
+c     *     it, others wait at the critical section                  *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine seg_lookup_check( curve_set )
+      use segmental_curves, only : seg_lookup_built
+      implicit none
+c
+      integer :: curve_set
+      logical :: built
+c
+!$OMP ATOMIC READ
+      built = seg_lookup_built(curve_set)
+      if( built ) then
+!$OMP FLUSH
+        return
+      end if
+c
+!$OMP CRITICAL (seg_lookup_build)
+      if( .not. seg_lookup_built(curve_set) ) then
+        call seg_lookup_build( curve_set )
+!$OMP FLUSH
+!$OMP ATOMIC WRITE
+        seg_lookup_built(curve_set) = .true.
+      end if
+!$OMP END CRITICAL (seg_lookup_build)
+c
+      return
+      end
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine seg_lookup_build                  *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     values and interval slopes of the elastic, cyclic and    *
+c     *     stress-strain curve data vs. the dependency variable     *
+c     *     (temperature or strain rate) for a curve set. curves in  *
+c     *     the set are already sorted by increasing value (inmat)   *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine seg_lookup_build( curve_set )
+      use segmental_curves
+      implicit none
+c
+      integer :: curve_set
+c
+      integer :: n, npts, ncols, i, j, k, curve_no, first_curve
+      double precision :: dx
+      double precision, parameter :: zero = 0.0d0
+c
+      n           = seg_curve_table(1,curve_set)
+      first_curve = seg_curve_table(2,curve_set)
+      npts        = num_seg_points(first_curve)
+      ncols       = seg_lookup_num_props + npts
+c
+      associate( t => seg_lookup(curve_set) )
+      if( allocated( t%x ) ) deallocate( t%x, t%y, t%slope )
+      t%num_curves = n
+      t%num_cols   = ncols
+      allocate( t%x(n), t%y(n,ncols), t%slope(n,ncols) )
+c
+      do i = 1, n
+        curve_no  = seg_curve_table(i+1,curve_set)
+        t%x(i)    = seg_curves_value(curve_no)
+        t%y(i,1)  = seg_curves_ym(curve_no)
+        t%y(i,2)  = seg_curves_nu(curve_no)
+        t%y(i,3)  = seg_curves_alpha(curve_no)
+        t%y(i,4)  = seg_curves_gp_sigma_0(curve_no)
+        t%y(i,5)  = seg_curves_gp_h_u(curve_no)
+        t%y(i,6)  = seg_curves_gp_beta_u(curve_no)
+        t%y(i,7)  = seg_curves_gp_delta_u(curve_no)
+        do j = 1, npts
+          t%y(i,seg_lookup_num_props+j) = seg_curves(j,2,curve_no)
+        end do
+      end do
+c
+c              slope row n stays zero so values beyond the last
+c              curve clamp to it. equal x values give a zero slope.
+c
+      t%slope = zero
+      do k = 1, n-1
+        dx = t%x(k+1) - t%x(k)
+        if( dx .le. zero ) cycle
+        do j = 1, ncols
+          t%slope(k,j) = ( t%y(k+1,j) - t%y(k,j) ) / dx
+        end do
+      end do
+      end associate
+c
+      return
+      end
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutine seg_lookup_locate                 *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     for each element in the span, the table row k and        *
+c     *     offset dx so value = y(k,:) + dx * slope(k,:). values    *
+c     *     outside the table clamp to the first/last curve as in    *
+c     *     linear_interpolate                                       *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine seg_lookup_locate( curve_set, span, xval, k, dx )
+      use segmental_curves, only : seg_lookup
+      implicit none
+c
+      integer :: curve_set, span, k(*)
+      double precision :: xval(*), dx(*)
+c
+      integer :: i, j, n, kk
+      double precision :: xe
+c
+      associate( t => seg_lookup(curve_set) )
+      n = t%num_curves
+!DIR$ IVDEP
+      do i = 1, span
+        xe = min( max( xval(i), t%x(1) ), t%x(n) )
+        kk = 0
+        do j = 1, n
+          if( t%x(j) .lt. xe ) kk = kk + 1
+        end do
+        kk    = max( 1, kk )
+        k(i)  = kk
+        dx(i) = xe - t%x(kk)
+      end do
+      end associate
+c
+      return
+      end
 c     ****************************************************************
 c     *                                                              *
 c     *                  function linear_interpolate                 *
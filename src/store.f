@@ -4,7 +4,7 @@ c     *                      subroutine store                        *
 c     *                                                              *
 c     *                       written by : bh                        *
 c     *                                                              *
-c     *                   last modified : 12/3/2019 rhd              *
+c     *                   last modified : 10/19/2026 agent           *
 c     *                                                              *
 c     *                  writes analysis restart file                *
 c     *                                                              *
@@ -129,6 +129,26 @@ c                       we write a record containing a 'check' variable
 c                       to catch any inconsistencies between the save
 c                       here and reopen
 c
+c                       restart format version. a negative key
+c                       cannot be the first item (numnod) of a
+c                       version 0 file. versions:
+c
+c                        0: no version record
+c                        1: solution parameters for deterministic
+c                           internal force assembly, single
+c                           precision [K]/[D] storage, adaptive
+c                           step targets, quadratic extrapolation,
+c                           arc length, cheap line search trials,
+c                           explicit dynamics, automatic solver
+c                           choice, Anderson acceleration, per
+c                           point umat calls. written after the
+c                           double precision scalars
+c                        2: mm10 reduced-order crystal groups
+c                           (cluster_rep, cluster_wgt) after the
+c                           crystal definitions
+c
+      write(fileno) restart_format_key, restart_format_version
+c
 c                       write error flags
 c
       write(fileno) numnod,numel,fatal,coor,elprop,elinc,constr,block
@@ -205,6 +225,19 @@ c
       write (fileno) check_data_key
 c
 c
+c                       write out solution parameters added in
+c                       format version 1.
+c
+c
+      write(fileno) adapt_target_iters, arc_target_iters, anderson_depth
+      write(fileno) deterministic_ifv, estiff_single_prec,
+     &              cep_single_prec, extrap_quadratic, arc_length,
+     &              ls_cheap_trials, explicit_dynamics, solver_auto,
+     &              anderson_accel, umat_per_point
+      write(fileno) arc_radius, arc_lambda, explicit_dt_fraction
+      write (fileno) check_data_key
+c
+c
 c                       write out real  (scalar) variables.
 c
       write (fileno) time_limit
@@ -869,8 +902,10 @@ c
           write(fileno) check_data_key
        end if
        if ( cep_blk_list(blk) .gt. 0 ) then
+          call cep_blk_expand( blk ) ! file is always double
           write(fileno) cep_blocks(blk)%vector
           write(fileno) check_data_key
+          call cep_blk_compact( blk )
        end if
       end do
 c
@@ -1002,7 +1037,7 @@ c     *               subroutine write_cry_data                      *
 c     *                                                              *
 c     *                    written by : mcm                          *
 c     *                                                              *
-c     *                last modified : 12/23/2015 rhd                *
+c     *                last modified : 10/19/2026 agent              *
 c     *                                                              *
 c     *           Write the CP crystal definitions to file           *
 c     *                                                              *
@@ -1037,6 +1072,17 @@ c
         write(fileno) simple_angles
         write(fileno) mc_array
       end if
+c
+c                       reduced-order crystal groups. members split
+c                       off during the solution cannot be rebuilt from
+c                       the orientations (format version 2)
+c
+      write(fileno) allocated( cluster_rep )
+      if( allocated( cluster_rep ) ) then
+        write(fileno) size(cluster_rep,1), size(cluster_rep,2)
+        write(fileno) cluster_rep
+        write(fileno) cluster_wgt
+      end if
 c
       return
       end subroutine
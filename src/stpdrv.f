@@ -23,6 +23,7 @@ c
      &                      user_cnstrn_stp_factors
 c
       use damage_data, only : growth_by_kill, growth_by_release
+      use elem_block_data, only : estiff_blk_frozen
 c
       implicit none
 c
@@ -352,8 +353,12 @@ c
       call modify_load( load_reduce_fact, mf, mf_nm1, now_step )
 c
 c          flags for new constraints and new dynamic
-c          analysis parameters
+c          analysis parameters. new constraints may change the
+c          nodal transformations applied to element [K]s so
+c          any re-usable [K]s must be recomputed
 c
+      if( new_constraints .and. allocated( estiff_blk_frozen ) )
+     &    estiff_blk_frozen = .false.
       new_constraints    = .false.
       new_analysis_param = .false.
 c
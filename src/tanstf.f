@@ -102,7 +102,7 @@ c     *                      subroutine do_nlek_block                *
 c     *                                                              *          
 c     *                       written by : rhd                       *          
 c     *                                                              *          
-c     *                   last modified : 7/17/2019 rhd              *          
+c     *                   last modified : 10/19/2026 agent           *          
 c     *                                                              *          
 c     *     computes the global nonlinear stiffness                  *          
 c     *     matrices for a block of elements. the data structures    *          
@@ -118,7 +118,7 @@ c
       use global_data ! old common.main
 c                                                                               
       use elem_block_data,   only : estiff_blocks, cdest_blocks,                
-     &                              edest_blocks                                
+     &                              edest_blocks, estiff_blk_frozen
       use elem_extinct_data, only : dam_state, dam_blk_killed                                                                                                 
       use main_data,         only : trn, incid, incmap,                         
      &                              cohesive_ele_types, link_types,                         
@@ -144,7 +144,8 @@ c
       include 'include_tan_ek'                                                  
       double precision, parameter :: zero = 0.0d0
       logical :: geo_non_flg, bbar_flg,                            
-     &           symmetric_assembly, block_is_killable 
+     &           symmetric_assembly, block_is_killable, linear_blk,
+     &           dynamic
       logical, parameter :: local_debug = .false.                         
       integer :: felem, elem_type, int_order, mat_type, num_enodes,             
      &           num_enode_dof, totdof, num_int_points, span, utsz,             
@@ -211,6 +212,28 @@ c
       local_work%cep_sym_size       = 21 
       local_work%is_bar_elem    = bar_types(elem_type)
       local_work%is_link_elem   = link_types(elem_type)
+c
+c             the [K]s for a block of linear-elastic (mm01 with the
+c             linear_elastic option), small-strain elements do not
+c             change from one update to the next. re-use the stored
+c             [K]s unless something else changes them: temperature
+c             loading this step, dynamics (mass is added to [K] in
+c             place), contact penalties or element killing.
+c             estiff_blk_frozen is reset on new constraints.
+c
+      dynamic = total_mass .gt. zero .and. dt .gt. zero
+      block_is_killable = .false.
+      if( growth_by_kill )
+     &   block_is_killable = iand( iprops(30,felem),2 ) .ne. 0
+      linear_blk = mat_type .eq. 1 .and. lprops(17,felem) .and.
+     &             .not. geo_non_flg .and. .not. temperatures .and.
+     &             .not. dynamic .and. .not. use_contact .and.
+     &             .not. block_is_killable
+      if( linear_blk .and. estiff_blk_frozen(blk) ) then
+        if( local_debug ) write(*,*) 'blk ',blk,' linear, re-use [K]s'
+        return
+      end if
+      estiff_blk_frozen(blk) = .false.
 c                                                                               
       if( local_work%is_umat ) call material_model_info( felem, 0, 3,           
      &                                 local_work%umat_stress_type )            
@@ -248,6 +271,7 @@ c
       call chk_killed_blk( local_work%blk,
      &      local_work%killed_status_vec,
      &      local_work%block_killed )                  
+      call estiff_blk_expand( blk, .false. )
       estiff_blocks(blk)%ptr(1:nrow_ek,1:span) = zero                           
 c                                                                               
 c             check if blk has all killed elements -- if so skip                
@@ -256,6 +280,7 @@ c
       if( growth_by_kill ) then  ! note return inside here                      
         if( local_work%block_killed ) then                                      
           if( local_debug ) write (*,*)'blk ',blk,' killed, skip.'              
+          call estiff_blk_compact( blk )
           return  ! no tanstf_deallocate  needed                                
         end if                                                                  
       end if                                                                    
@@ -315,9 +340,11 @@ c             pass first element in block of props table.
 c                                                                               
                                                                                 
       ispan  = span   ! just protects span value                                
+      call cep_blk_expand( blk )
       call rktstf( props(1,felem), iprops(1,felem),                             
      &             lprops(1,felem), estiff_blocks(blk)%ptr,                
      &             nrow_ek, ispan, local_work )                                 
+      call cep_blk_compact( blk )
 c                                                                               
 c             check if this block has any killed elements -- if so,             
 c             zero computed nonlinear stifffness matrices for killed            
@@ -349,6 +376,8 @@ c             release all allocated data for block. data never
 c             allocated above for a killed block of elements                    
 c                                                                               
       call tanstf_deallocate( local_work )                                      
+      call estiff_blk_compact( blk )
+      estiff_blk_frozen(blk) = linear_blk
       return                                                                    
 c                                                                               
  9100 format(5x,'>>> ready to call dptstf:',                                    
@@ -367,12 +396,14 @@ c     *                subroutine estiff_allocate                    *
 c     *                                                              *          
 c     *                    written by : rhd                          *          
 c     *                                                              *          
-c     *                last modified : 6/21/2017 rhd                 *          
+c     *                last modified : 10/19/2026 agent              *
 c     *                                                              *          
 c     *     create the blocked data structure for storage of element *          
 c     *     stiffness matrices                                       *          
 c     *        symmetric - upper triangle including diagonal         *          
 c     *       asymmetric - lower and upper triangle                  *          
+c     *     single precision storage option puts the blocks in       *
+c     *     estiff_blocks_sp (see estiff_blk_expand)                 *
 c     *     runs outside any threaded region.                        *          
 c     *                                                              *          
 c     ****************************************************************          
@@ -380,8 +411,9 @@ c
       subroutine estiff_allocate( type )                                        
       use global_data ! old common.main
 c                                                                               
-      use elem_block_data, only:  estiff_blocks                                 
-      use main_data, only: asymmetric_assembly                                  
+      use elem_block_data, only:  estiff_blocks, estiff_blk_frozen,
+     &                            estiff_blocks_sp
+      use main_data, only: asymmetric_assembly, estiff_single_prec
 c                                                                               
       implicit none                                                             
 c                                                                               
@@ -422,9 +454,13 @@ c
               write(out,9100) iok, 1, myid                                              
               call die_abort                                                    
            end if                                                               
+           allocate( estiff_blocks_sp(nelblk) )
            do blk = 1, nelblk                                                   
             nullify( estiff_blocks(blk)%ptr )                                   
+            nullify( estiff_blocks_sp(blk)%ptr )
            end do                                                               
+           allocate( estiff_blk_frozen(nelblk) )
+           estiff_blk_frozen = .false.
          end if                                                                 
 c                                                                               
          do blk = 1, nelblk 
@@ -439,19 +475,24 @@ c
             utsz          = ((totdof*totdof)-totdof)/2 + totdof                 
             nrow_block    = utsz                                               
             if( asymmetric_assembly ) nrow_block = totdof*totdof   
-            makeblk = .not. associated(estiff_blocks(blk)%ptr)
+            makeblk = .not. estiff_blk_exists()
             if( makeblk ) then 
-              allocate( estiff_blocks(blk)%ptr(nrow_block,span),
-     &                  stat=iok )            
-              if( iok .ne. 0 ) then                                               
-               write(out,9100) iok, 2, myid                                             
-              end if
+              call estiff_allocate_blk
+              if( iok .ne. 0 ) write(out,9100) iok, 2, myid
             else
-              chksize = size( estiff_blocks(blk)%ptr )
+              chksize = estiff_blk_size()
               if( chksize .ne. nrow_block*span ) then
                  write(out,9310) blk, 1, myid
                  call die_abort
               end if
+c
+c                 storage precision may have been changed
+c
+              if( estiff_single_prec ) then
+                call estiff_blk_compact( blk )
+              else
+                call estiff_blk_expand( blk, .true. )
+              end if
             end if       
          end do 
 c                                                                           
@@ -475,15 +516,12 @@ c
             utsz          = ((totdof*totdof)-totdof)/2 + totdof                 
             nrow_block    = utsz                                                
             if( asymmetric_assembly ) nrow_block = totdof * totdof   
-            makeblk       = .not. associated(estiff_blocks(blk)%ptr)
+            makeblk       = .not. estiff_blk_exists()
             if( makeblk ) then 
-              allocate( estiff_blocks(blk)%ptr(nrow_block,span),
-     &                  stat=iok )            
-              if( iok .ne. 0 ) then                                               
-               write(out,9100) iok, 3, myid                                             
-              end if
+              call estiff_allocate_blk
+              if( iok .ne. 0 ) write(out,9100) iok, 3, myid
             else
-              chksize = size( estiff_blocks(blk)%ptr )
+              chksize = estiff_blk_size()
               if( chksize .ne. nrow_block*span ) then
                  write(out,9310) blk, 2, myid
                  call die_abort
@@ -514,14 +552,15 @@ c
             utsz          = ((totdof*totdof)-totdof)/2 + totdof                 
             nrow_block    = utsz                                               
             if( asymmetric_assembly ) nrow_block = totdof * totdof   
-            blk_exists =  associated(estiff_blocks(blk)%ptr)
+            blk_exists =  estiff_blk_exists()
             if( blk_exists ) then
-               chksize = size( estiff_blocks(blk)%ptr )
+               chksize = estiff_blk_size()
                if( chksize .ne. nrow_block*span ) then
                  write(out,9310) blk, 4, myid
                  call die_abort
                end if
-               call estiff_allocate_chk( count_msg )
+               if( associated( estiff_blocks(blk)%ptr ) )
+     &             call estiff_allocate_chk( count_msg )
             else
                write(out,9400) 3, myid
                call die_abort
@@ -552,14 +591,15 @@ c
             utsz          = ((totdof*totdof)-totdof)/2 + totdof                 
             nrow_block    = utsz                                              
             if( asymmetric_assembly ) nrow_block = totdof * totdof   
-            blk_exists =  associated(estiff_blocks(blk)%ptr)
+            blk_exists =  estiff_blk_exists()
             if( blk_exists ) then
-               chksize = size( estiff_blocks(blk)%ptr )
+               chksize = estiff_blk_size()
                if( chksize .ne. nrow_block*span ) then
                  write(out,9310) blk, 4, myid
                  call die_abort
                end if
-               call estiff_allocate_chk( count_msg )
+               if( associated( estiff_blocks(blk)%ptr ) )
+     &             call estiff_allocate_chk( count_msg )
             else
                write(out,9400) 3, myid
                call die_abort
@@ -576,13 +616,20 @@ c
          end if     
 c
          do blk = 1, nelblk  
-            blk_exists = associated(estiff_blocks(blk)%ptr)
+            blk_exists = estiff_blk_exists()
             if( blk_exists ) then
-               deallocate( estiff_blocks(blk)%ptr, stat=iok )                      
+               iok = 0
+               if( associated( estiff_blocks(blk)%ptr ) )
+     &           deallocate( estiff_blocks(blk)%ptr, stat=iok )
+               if( associated( estiff_blocks_sp(blk)%ptr ) )
+     &           deallocate( estiff_blocks_sp(blk)%ptr, stat=iok )
                if( iok .ne. 0 ) then                                               
                   write(out,9200) iok, blk                                             
                end if                                                              
                nullify( estiff_blocks(blk)%ptr ) 
+               nullify( estiff_blocks_sp(blk)%ptr )
+               if( allocated( estiff_blk_frozen ) )
+     &             estiff_blk_frozen(blk) = .false.
             else
                write(out,9400) 5, myid
                call die_abort
@@ -614,6 +661,31 @@ c
 
       contains
 c     ========
+c
+      logical function estiff_blk_exists()
+      implicit none
+      estiff_blk_exists = associated( estiff_blocks(blk)%ptr ) .or.
+     &                    associated( estiff_blocks_sp(blk)%ptr )
+      end function estiff_blk_exists
+c
+      integer function estiff_blk_size()
+      implicit none
+      if( associated( estiff_blocks(blk)%ptr ) ) then
+        estiff_blk_size = size( estiff_blocks(blk)%ptr )
+      else
+        estiff_blk_size = size( estiff_blocks_sp(blk)%ptr )
+      end if
+      end function estiff_blk_size
+c
+      subroutine estiff_allocate_blk
+      implicit none
+      if( estiff_single_prec ) then
+        allocate( estiff_blocks_sp(blk)%ptr(nrow_block,span),
+     &            stat=iok )
+      else
+        allocate( estiff_blocks(blk)%ptr(nrow_block,span), stat=iok )
+      end if
+      end subroutine estiff_allocate_blk
 
       subroutine estiff_allocate_chk( count )
       implicit none
@@ -644,6 +716,75 @@ c     ========
       
       end subroutine estiff_allocate_chk              
       end subroutine estiff_allocate                                                                  
+c     ****************************************************************
+c     *                                                              *
+c     *                 subroutines estiff_blk_expand                *
+c     *                             estiff_blk_compact               *
+c     *                                                              *
+c     *                       written by : agent                     *
+c     *                                                              *
+c     *                   last modified : 10/19/2026 agent           *
+c     *                                                              *
+c     *     move a block of element [K]s between the single          *
+c     *     precision store and the double precision estiff_blocks   *
+c     *     the element routines compute into. copy = .false. when   *
+c     *     the caller overwrites the whole block. no-ops for        *
+c     *     double precision storage                                 *
+c     *                                                              *
+c     ****************************************************************
+c
+      subroutine estiff_blk_expand( blk, copy )
+      use elem_block_data, only : estiff_blocks, estiff_blocks_sp
+      use main_data, only : estiff_single_prec
+      implicit none
+c
+      integer :: blk
+      logical :: copy
+c
+      integer :: nrow, ncol
+c
+      if( .not. allocated( estiff_blocks_sp ) ) return
+      if( associated( estiff_blocks(blk)%ptr ) ) return
+      if( .not. associated( estiff_blocks_sp(blk)%ptr ) ) return
+c
+      nrow = size( estiff_blocks_sp(blk)%ptr, 1 )
+      ncol = size( estiff_blocks_sp(blk)%ptr, 2 )
+      allocate( estiff_blocks(blk)%ptr(nrow,ncol) )
+      if( copy ) estiff_blocks(blk)%ptr =
+     &                 dble( estiff_blocks_sp(blk)%ptr )
+c
+c              switched to double precision storage. release
+c
+      if( .not. estiff_single_prec ) then
+        deallocate( estiff_blocks_sp(blk)%ptr )
+        nullify( estiff_blocks_sp(blk)%ptr )
+      end if
+c
+      return
+      end
+c
+      subroutine estiff_blk_compact( blk )
+      use elem_block_data, only : estiff_blocks, estiff_blocks_sp
+      use main_data, only : estiff_single_prec
+      implicit none
+c
+      integer :: blk
+c
+      integer :: nrow, ncol
+c
+      if( .not. estiff_single_prec ) return
+      if( .not. associated( estiff_blocks(blk)%ptr ) ) return
+c
+      nrow = size( estiff_blocks(blk)%ptr, 1 )
+      ncol = size( estiff_blocks(blk)%ptr, 2 )
+      if( .not. associated( estiff_blocks_sp(blk)%ptr ) )
+     &   allocate( estiff_blocks_sp(blk)%ptr(nrow,ncol) )
+      estiff_blocks_sp(blk)%ptr = real( estiff_blocks(blk)%ptr )
+      deallocate( estiff_blocks(blk)%ptr )
+      nullify( estiff_blocks(blk)%ptr )
+c
+      return
+      end
 c     ****************************************************************          
 c     *                                                              *          
 c     *                  subroutine dptstf_blocks                    *          
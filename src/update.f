@@ -4,7 +4,7 @@ c     *                      subroutine update                       *
 c     *                                                              *          
 c     *                       written by : bh                        *          
 c     *                                                              *          
-c     *                   last modified : 2/17/2017 rhd              *          
+c     *                   last modified : 10/19/2026 agent           *          
 c     *                                                              *          
 c     *     various updates of vectors required after the iterative  *          
 c     *     solution procedure for a step has been completed.        *          
@@ -18,7 +18,7 @@ c
 c                                                                               
       use main_data, only :  temper_nodes, temper_elems,                        
      &                       dtemp_nodes, dtemp_elems, mdiag,                   
-     &                       nonlocal_analysis                            
+     &                       nonlocal_analysis, explicit_active
       use elem_block_data, only : history_blocks, history1_blocks,              
      &                            eps_n_blocks, eps_n1_blocks,                  
      &                            urcs_n_blocks, urcs_n1_blocks,                
@@ -56,7 +56,11 @@ c                       and accelerations at n and the converged
 c                       displacement increment (du) over the step.              
 c                       skip if we are on worker ranks                          
 c                                                                               
-      if( root_processor ) call newmrk( nodof, nbeta, dt, du, v, a )            
+c                       explicit (central difference) steps have
+c                       already set v and a at n+1 in mnralg.
+c
+      if( root_processor .and. .not. explicit_active )
+     &    call newmrk( nodof, nbeta, dt, du, v, a )
 c                                                                               
 c                       compute the equivalent loads for the con-               
 c                       strained dof.                                           
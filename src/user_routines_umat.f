@@ -15,6 +15,11 @@ c
 c              gplns1.f    -- linear stiffness computation                      
 c              rstgp1.f    -- stress update and new [D] computation             
 c                                                                               
+c           rstgp1.f calls umat_batch instead of umat for the stress            
+c           update when umat_set_features asks for it. umat_batch gets          
+c           all elements of a block at an integration point in one              
+c           call. gplns1.f always calls umat.                                   
+c                                                                               
 c           These above two code fies have lots of comments about setting       
 c           up data arrays, values for the umat from WARP3D data                
 c           structures.                                                         
@@ -25,7 +30,7 @@ c     *                 subroutine umat_set_features                 *
 c     *                                                              *          
 c     *                       written by : rhd                       *          
 c     *                                                              *          
-c     *                   last modified: 12/14/14 rhd                *          
+c     *                   last modified: 10/19/2026 agent            *          
 c     *                                                              *          
 c     *  called by warp3d for the umat to obtain statev size and     *          
 c     *  other characteristic information about the umat             *          
@@ -54,15 +59,30 @@ c
 c         4        number of state variables per point to be output             
 c                  when user requests this type of results                      
 c                                                                               
+c         5        = 0, WARP3D calls umat for each element (default)            
+c                  = 1, WARP3D calls umat_batch for the stress update           
+c                       with all elements of a block at an                      
+c                       integration point (umat batch off in the                
+c                       solution parameters restores per element                
+c                       calls)                                                  
+c                                                                               
+c         6        number of words of scratch umat_batch wants for              
+c                  each thread. WARP3D allocates this once outside              
+c                  the threaded loop.                                           
 c                                                                               
 c                                                                               
 c        example umat included here is for mises plasticity with                
-c        bilinear kinematic hardening                                           
+c        bilinear kinematic hardening. umat_batch below is the same             
+c        model over a span and is used for the stress update. the               
+c        solution parameter "umat batch off" calls umat point by                
+c        point instead.                                                         
 c                                                                               
       info_vector(1) = 20   ! includes back stresses                            
       info_vector(2) = 21                                                       
       info_vector(3) = 0                                                        
       info_vector(4) = 14                                                       
+      info_vector(5) = 1                                                        
+      info_vector(6) = 0                                                        
 c                                                                              
       return                                                                    
       end                                                                       
@@ -332,6 +352,196 @@ c
       end                                                                       
 c     ****************************************************************          
 c     *                                                              *          
+c     *   subroutine umat_batch -- bilinear kinematic hardening      *          
+c     *                                                              *          
+c     *                       written by : agent                     *          
+c     *                                                              *          
+c     *                   last modified: 10/19/2026 agent            *          
+c     *                                                              *          
+c     *  span version of the example umat above. WARP3D calls this   *          
+c     *  once for all elements of a block at integration point npt   *          
+c     *  when umat_set_features sets info_vector(5) = 1. arrays are  *          
+c     *  (mxvl, ...) with element i of the block in row i. element   *          
+c     *  number is felem + i - 1. drot is always identity and        *          
+c     *  WARP3D ignores rpl, ddsddt, drplde, drpldt so they are not  *          
+c     *  passed. scratch(nscratch) belongs to the calling thread     *          
+c     *  and is sized by info_vector(6).                             *          
+c     *                                                              *          
+c     ****************************************************************          
+c                                                                               
+      subroutine umat_batch( span, mxvl, felem, npt, stress, statev,            
+     1 ddsdde, sse, spd, scd, stran, dstran, time, dtime, temp, dtemp,          
+     2 ndi, nshr, ntens, nstatv, props, nprops, coords, pnewdt,                 
+     3 celent, dfgrd0, dfgrd1, kstep, kinc, kiter, kout, kthread,               
+     4 knumthreads, nonlocal_shared, nshared, scratch, nscratch )               
+c                                                                               
+      implicit none                                                             
+c                                                                               
+      integer :: span, mxvl, felem, npt, ndi, nshr, ntens, nstatv,              
+     1           nprops, kstep, kinc, kiter, kout, kthread,                     
+     2           knumthreads, nshared, nscratch                                 
+c                                                                               
+      double precision :: stress(mxvl,ntens), statev(mxvl,*),                   
+     1 ddsdde(mxvl,ntens,ntens), sse(mxvl), spd(mxvl), scd(mxvl),               
+     2 stran(mxvl,ntens), dstran(mxvl,ntens), time(2), dtime,                   
+     3 temp(mxvl), dtemp(mxvl), props(mxvl,nprops), coords(mxvl,3),             
+     4 pnewdt(mxvl), celent(mxvl), dfgrd0(mxvl,3,3),                            
+     5 dfgrd1(mxvl,3,3), nonlocal_shared(mxvl,nshared),                         
+     6 scratch(*)                                                               
+c                                                                               
+c           locals. same model and statev layout as umat above.                 
+c           the example needs no scratch.                                       
+c                                                                               
+      integer :: i, k1, k2                                                      
+      logical :: yielding(mxvl)                                                 
+      double precision :: flow(mxvl,6), eg(mxvl), eg3(mxvl),                    
+     1                    ebulk3(mxvl), deqpl(mxvl), effhrd(mxvl),              
+     2                    cte, emod, enu, eg2, elam, smises, syield,            
+     3                    hard, shydro, effg, effg2, efflam, old_eqpl,          
+     4                    new_eqpl, dsst, dspd, state_np1, rsm, osy,            
+     5                    nsy, s(6), a(6), ds(6)                                
+      double precision, parameter :: zero=0.d0, one=1.d0, two=2.d0,             
+     1                               three=3.d0, six=6.d0,                      
+     2                               enumax=.4999d0, toler=1.0d-6,              
+     3                               half=0.5d0, onep5=1.5d0                    
+c                                                                               
+c           1. elastic moduli, trial stress and yield check. no                 
+c              element-to-element dependence: the loop vectorizes               
+c              with the plastic correction done under a mask.                   
+c                                                                               
+!DIR$ IVDEP                                                                     
+      do i = 1, span                                                            
+        cte  = props(i,5)                                                       
+        emod = props(i,1)                                                       
+        enu  = min( props(i,2), enumax )                                        
+        ebulk3(i) = emod / (one-two*enu)                                        
+        eg2       = emod / (one+enu)                                            
+        eg(i)     = eg2 / two                                                   
+        eg3(i)    = three * eg(i)                                               
+        elam      = (ebulk3(i)-eg2) / three                                     
+        syield    = props(i,3)                                                  
+        hard      = props(i,4)                                                  
+c                                                                               
+        dstran(i,1) = dstran(i,1) - cte * dtemp(i)                              
+        dstran(i,2) = dstran(i,2) - cte * dtemp(i)                              
+        dstran(i,3) = dstran(i,3) - cte * dtemp(i)                              
+c                                                                               
+        do k1 = 1, 6                                                            
+         ds(k1) = dstran(i,k1)                                                  
+         a(k1)  = statev(i,k1+12)                                               
+         statev(i,k1) = statev(i,k1) + ds(k1)    ! trial elastic                
+        end do                                                                  
+        s(1) = stress(i,1) + elam*(ds(1)+ds(2)+ds(3)) + eg2*ds(1)               
+        s(2) = stress(i,2) + elam*(ds(1)+ds(2)+ds(3)) + eg2*ds(2)               
+        s(3) = stress(i,3) + elam*(ds(1)+ds(2)+ds(3)) + eg2*ds(3)               
+        s(4) = stress(i,4) + eg(i)*ds(4)                                        
+        s(5) = stress(i,5) + eg(i)*ds(5)                                        
+        s(6) = stress(i,6) + eg(i)*ds(6)                                        
+c                                                                               
+        smises = (s(1)-a(1)-s(2)+a(2))**2                                       
+     1         + (s(2)-a(2)-s(3)+a(3))**2                                       
+     2         + (s(3)-a(3)-s(1)+a(1))**2                                       
+     3         + six*( (s(4)-a(4))**2 + (s(5)-a(5))**2                          
+     4         + (s(6)-a(6))**2 )                                               
+        smises = sqrt( smises/two )                                             
+        yielding(i) = smises .gt. (one+toler)*syield                            
+        deqpl(i)    = zero                                                      
+        if( yielding(i) ) deqpl(i) = (smises-syield)/(eg3(i)+hard)              
+c                                                                               
+        rsm    = one / max( smises, tiny(one) )                                 
+        shydro = (s(1)+s(2)+s(3)) / three                                       
+        flow(i,1) = (s(1)-a(1)-shydro) * rsm                                    
+        flow(i,2) = (s(2)-a(2)-shydro) * rsm                                    
+        flow(i,3) = (s(3)-a(3)-shydro) * rsm                                    
+        flow(i,4) = (s(4)-a(4)) * rsm                                           
+        flow(i,5) = (s(5)-a(5)) * rsm                                           
+        flow(i,6) = (s(6)-a(6)) * rsm                                           
+c                                                                               
+c           2. return to the yield surface. deqpl = 0 leaves the                
+c              elastic trial state unchanged. energy increments use             
+c              the average stress over the step.                                
+c                                                                               
+        dsst = zero                                                             
+        do k1 = 1, 6                                                            
+          a(k1) = a(k1) + hard*flow(i,k1)*deqpl(i)                              
+        end do                                                                  
+        do k1 = 1, 3                                                            
+          statev(i,k1+6) = statev(i,k1+6) + onep5*flow(i,k1)*deqpl(i)           
+          statev(i,k1)   = statev(i,k1)   - onep5*flow(i,k1)*deqpl(i)           
+          if( yielding(i) ) s(k1) = a(k1) + flow(i,k1)*syield + shydro          
+        end do                                                                  
+        do k1 = 4, 6                                                            
+          statev(i,k1+6) = statev(i,k1+6) + three*flow(i,k1)*deqpl(i)           
+          statev(i,k1)   = statev(i,k1)   - three*flow(i,k1)*deqpl(i)           
+          if( yielding(i) ) s(k1) = a(k1) + flow(i,k1)*syield                   
+        end do                                                                  
+        do k1 = 1, 6                                                            
+          dsst = dsst + half*( s(k1) + stress(i,k1) ) * ds(k1)                  
+          stress(i,k1)    = s(k1)                                               
+          statev(i,k1+12) = a(k1)                                               
+        end do                                                                  
+c                                                                               
+        old_eqpl  = statev(i,19)                                                
+        new_eqpl  = old_eqpl + deqpl(i)                                         
+        osy       = syield + hard * old_eqpl                                    
+        nsy       = syield + hard * new_eqpl                                    
+        dspd      = deqpl(i) * ( osy + nsy ) * half                             
+        state_np1 = zero                                                        
+        if( old_eqpl .gt. zero ) state_np1 = two                                
+        if( yielding(i) ) state_np1 = one                                       
+        statev(i,19) = new_eqpl                                                 
+        statev(i,20) = state_np1                                                
+        sse(i) = sse(i) + (dsst - dspd)                                         
+        spd(i) = spd(i) + dspd                                                  
+c                                                                               
+c           3. tangent moduli. elastic values when not yielding                 
+c              (effg = eg, effhrd = 0)                                          
+c                                                                               
+        effg = eg(i)                                                            
+        effhrd(i) = zero                                                        
+        if( yielding(i) ) then                                                  
+          effg = eg(i)*(syield+hard*deqpl(i)) * rsm                             
+          effhrd(i) = eg3(i)*hard/(eg3(i)+hard) - three*effg                    
+        end if                                                                  
+        effg2  = two * effg                                                     
+        efflam = (ebulk3(i)-effg2) / three                                      
+        do k1 = 1, 6                                                            
+          do k2 = 1, 6                                                          
+            ddsdde(i,k2,k1) = zero                                              
+          end do                                                                
+        end do                                                                  
+        do k1 = 1, 3                                                            
+          do k2 = 1, 3                                                          
+            ddsdde(i,k2,k1) = efflam                                            
+          end do                                                                
+          ddsdde(i,k1,k1) = effg2 + efflam                                      
+          ddsdde(i,k1+3,k1+3) = effg                                            
+        end do                                                                  
+      end do                                                                    
+c                                                                               
+      do k1 = 1, 6                                                              
+        do k2 = 1, 6                                                            
+!DIR$ IVDEP                                                                     
+          do i = 1, span                                                        
+            ddsdde(i,k2,k1) = ddsdde(i,k2,k1) +                                 
+     &                        effhrd(i)*flow(i,k2)*flow(i,k1)                   
+          end do                                                                
+        end do                                                                  
+      end do                                                                    
+c                                                                               
+c           nonlocal shared values = element number for testing                 
+c                                                                               
+      do k1 = 1, nshared                                                        
+!DIR$ IVDEP                                                                     
+        do i = 1, span                                                          
+          nonlocal_shared(i,k1) = dble( felem + i - 1 )                         
+        end do                                                                  
+      end do                                                                    
+c                                                                               
+      return                                                                    
+      end                                                                       
+c     ****************************************************************          
+c     *                                                              *          
 c     *             subroutine umat_states_labels                    *          
 c     *                                                              *          
 c     *   call by WARP3D to get the number of states variables for   *          
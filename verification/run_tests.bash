@@ -36,6 +36,20 @@ test84
 test85
 test86
 test87
+test88
+test89
+test90
+test91
+test92
+test93
+test94
+test95
+test96
+test97
+test98
+test99
+test100
+test101
 }
 function test14 {
 echo -e "\n>>> Test 14 (Linear elastic impact, sparse iterative solver)"
@@ -313,6 +327,118 @@ cd test87
 cd ..
 }
 
+function test88 {
+echo -e "\n>>> Test 88 (explicit dynamics. elastic wave in a bar)"
+echo      "    =================================================="
+cd test88
+./run_tests_and_check
+cd ..
+}
+
+function test89 {
+echo -e "\n>>> Test 89 (arc length. snap-through of a shallow truss)"
+echo      "    ====================================================="
+cd test89
+./run_tests_and_check
+cd ..
+}
+
+function test90 {
+echo -e "\n>>> Test 90 (anderson acceleration. hollow sphere)"
+echo      "    =============================================="
+cd test90
+./run_tests_and_check
+cd ..
+}
+
+function test91 {
+echo -e "\n>>> Test 91 (reset solution. several cases in one run)"
+echo      "    =================================================="
+cd test91
+./run_tests_and_check
+cd ..
+}
+
+function test92 {
+echo -e "\n>>> Test 92 (deterministic internal forces. 1 vs. n threads)"
+echo      "    ========================================================"
+cd test92
+./run_tests_and_check
+cd ..
+}
+
+function test93 {
+echo -e "\n>>> Test 93 (gurson model. vectorized return mapping)"
+echo      "    ================================================="
+cd test93
+./run_tests_and_check
+cd ..
+}
+
+function test94 {
+echo -e "\n>>> Test 94 (principal values. direction cosines)"
+echo      "    ============================================="
+cd test94
+./run_tests_and_check
+cd ..
+}
+
+function test95 {
+echo -e "\n>>> Test 95 (single precision [K] and [D] storage)"
+echo      "    =============================================="
+cd test95
+./run_tests_and_check
+cd ..
+}
+
+function test96 {
+echo -e "\n>>> Test 96 (adaptive step control. target iterations)"
+echo      "    =================================================="
+cd test96
+./run_tests_and_check
+cd ..
+}
+
+function test97 {
+echo -e "\n>>> Test 97 (quadratic extrapolation of displacements)"
+echo      "    =================================================="
+cd test97
+./run_tests_and_check
+cd ..
+}
+
+function test98 {
+echo -e "\n>>> Test 98 (line search. cheap trial passes)"
+echo      "    ========================================="
+cd test98
+./run_tests_and_check
+cd ..
+}
+
+function test99 {
+echo -e "\n>>> Test 99 (solution technique auto)"
+echo      "    ================================="
+cd test99
+./run_tests_and_check
+cd ..
+}
+
+function test100 {
+echo -e "\n>>> Test 100 (umat_batch stress update)"
+echo      "    ==================================="
+cd test100
+./run_tests_and_check
+cd ..
+}
+
+function test101 {
+echo -e "\n>>> Test 101 (iteration 0 reuse of converged internal forces)"
+echo      "    ========================================================="
+cd test101
+./run_tests_and_check
+cd ..
+}
+
 
 
 function get_num_threads {
@@ -474,6 +600,20 @@ m_test84="Test 84: (link2 element; Periodic Boundary Conditions)"
 m_test85="Test 85: (user-defined initial-stresses)"
 m_test86="Test 86: (FGMs compute J. explicit terms needed for path independence)"
 m_test87="Test 87: (T-stress. surface cracked plate. face loading)"
+m_test88="Test 88: (explicit vs. implicit Newmark dynamics, elastic wave)"
+m_test89="Test 89: (arc-length solution through a limit point, bar2 truss)"
+m_test90="Test 90: (anderson acceleration vs. plain Newton, mises hollow sphere)"
+m_test91="Test 91: (reset solution, three load cases in one run)"
+m_test92="Test 92: (deterministic internal force assembly, 1 vs. n threads)"
+m_test93="Test 93: (gurson model with nucleation, vectorized return mapping)"
+m_test94="Test 94: (principal values and direction cosines, repeated roots)"
+m_test95="Test 95: (single precision storage of [K] and [D])"
+m_test96="Test 96: (adaptive step control with a target number of iterations)"
+m_test97="Test 97: (quadratic extrapolation of displacements, safeguards)"
+m_test98="Test 98: (line search with cheap trial passes, crystal plasticity)"
+m_test99="Test 99: (automatic choice of direct or iterative solver)"
+m_test100="Test 100: (umat_batch vs. umat called point by point)"
+m_test101="Test 101: (reuse of converged internal forces at iteration 0)"
 
 all="All problems"
 quit="Quit"
@@ -510,6 +650,20 @@ PS3="Enter your choice (<return> to repeat menu): "
      "$m_test85" \
      "$m_test86" \
      "$m_test87" \
+     "$m_test88" \
+     "$m_test89" \
+     "$m_test90" \
+     "$m_test91" \
+     "$m_test92" \
+     "$m_test93" \
+     "$m_test94" \
+     "$m_test95" \
+     "$m_test96" \
+     "$m_test97" \
+     "$m_test98" \
+     "$m_test99" \
+     "$m_test100" \
+     "$m_test101" \
      "$quit"
 #
   do
@@ -585,6 +739,34 @@ PS3="Enter your choice (<return> to repeat menu): "
              test85;;
           $m_test87)
              test87;;
+          $m_test88)
+             test88;;
+          $m_test89)
+             test89;;
+          $m_test90)
+             test90;;
+          $m_test91)
+             test91;;
+          $m_test92)
+             test92;;
+          $m_test93)
+             test93;;
+          $m_test94)
+             test94;;
+          $m_test95)
+             test95;;
+          $m_test96)
+             test96;;
+          $m_test97)
+             test97;;
+          $m_test98)
+             test98;;
+          $m_test99)
+             test99;;
+          $m_test100)
+             test100;;
+          $m_test101)
+             test101;;
           $quit)
            break;;
           *) printf "You can enter only 1, .....\n";;